@@ -0,0 +1,107 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "AllocationCounter.h"
+
+#if defined(COUNT_ALLOCATIONS)
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<unsigned long long> allocations(0U);
+
+static void* allocate(std::size_t size)
+{
+	allocations.fetch_add(1U, std::memory_order_relaxed);
+
+	// A zero length allocation must still return a unique pointer
+	return ::malloc(size == 0U ? 1U : size);
+}
+
+bool CAllocationCounter::isCounting()
+{
+	return true;
+}
+
+unsigned long long CAllocationCounter::get()
+{
+	return allocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+	void* p = allocate(size);
+	if (p == NULL)
+		throw std::bad_alloc();
+
+	return p;
+}
+
+void* operator new[](std::size_t size)
+{
+	void* p = allocate(size);
+	if (p == NULL)
+		throw std::bad_alloc();
+
+	return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+	::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+	::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+	::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+	::free(p);
+}
+
+#else
+
+bool CAllocationCounter::isCounting()
+{
+	return false;
+}
+
+unsigned long long CAllocationCounter::get()
+{
+	return 0U;
+}
+
+#endif
@@ -0,0 +1,37 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(ALLOCATIONCOUNTER_H)
+#define	ALLOCATIONCOUNTER_H
+
+// Counts the calls to the global operator new since the program started,
+// when built with COUNT_ALLOCATIONS ("make COUNT_ALLOCS=1"). The plain and
+// nothrow forms of new and new[] are replaced in AllocationCounter.cpp, and
+// only do a relaxed atomic add on top of malloc(). The sized and aligned
+// forms that later standards add are not replaced, so their calls are not
+// counted. It is read before and after a run of frames to show that a
+// decode path doesn't allocate once it has been set up.
+class CAllocationCounter {
+public:
+	// False if the operators aren't replaced in this build, get() is then always zero
+	static bool isCounting();
+
+	static unsigned long long get();
+};
+
+#endif
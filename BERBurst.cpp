@@ -0,0 +1,238 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "BERBurst.h"
+#include "BitUtils.h"
+
+#include <cstdio>
+#include <cassert>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define EOL	"\n"
+#else
+#define	EOL	"\r\n"
+#endif
+
+CBERBurst::CBERBurst() :
+m_frames(0U),
+m_badRun(0U),
+m_goodRun(0U),
+m_bursts(0U),
+m_burstFrames(0U),
+m_longestBurst(0U),
+m_gaps(0U),
+m_gapFrames(0U),
+m_longestGap(0U),
+m_bitBursts(0U),
+m_longestBitBurst(0U),
+m_n(0ULL),
+m_n1(0ULL),
+m_n1c(0ULL),
+m_n11(0ULL),
+m_n1x1(0ULL),
+m_n111(0ULL)
+{
+}
+
+CBERBurst::~CBERBurst()
+{
+}
+
+void CBERBurst::add(const unsigned char* errors, const unsigned char* checked, unsigned int bits)
+{
+	assert(errors != NULL);
+	assert((bits % 8U) == 0U);
+
+	unsigned int bytes = bits / 8U;
+
+	// The last two bits of the frame so far, for the patterns that straddle a byte boundary
+	unsigned int prev = 0U;
+	unsigned int prevChecked = 0U;
+	unsigned int run = 0U;
+	unsigned int total = 0U;
+
+	for (unsigned int i = 0U; i < bytes; i++) {
+		unsigned int b = errors[i];
+		unsigned int c = checked != NULL ? checked[i] : 0xFFU;
+
+		assert((b & ~c) == 0U);
+
+		m_n += CBitUtils::countBits(c);
+
+		unsigned int x  = (prev << 8) | b;
+		unsigned int xc = (prevChecked << 8) | c;
+
+		// An error with a checked bit after it, the count that P(1|1) is out of
+		m_n1c += CBitUtils::countBits(c & (x >> 1));
+
+		prevChecked = c & 0x03U;
+
+		if (b == 0x00U) {
+			if (run > 0U) {
+				m_bitBursts++;
+				if (run > m_longestBitBurst)
+					m_longestBitBurst = run;
+				run = 0U;
+			}
+
+			prev = 0U;
+			continue;
+		}
+
+		// Two errors a bit apart only count if the bit between them is checked
+		total  += CBitUtils::countBits(b);
+		m_n11  += CBitUtils::countBits(b & (x >> 1));
+		m_n1x1 += CBitUtils::countBits(b & (x >> 2) & (xc >> 1));
+		m_n111 += CBitUtils::countBits(b & (x >> 1) & (x >> 2));
+
+		for (unsigned int mask = 0x80U; mask != 0x00U; mask >>= 1) {
+			if ((b & mask) == mask) {
+				run++;
+			} else if (run > 0U) {
+				m_bitBursts++;
+				if (run > m_longestBitBurst)
+					m_longestBitBurst = run;
+				run = 0U;
+			}
+		}
+
+		prev = b & 0x03U;
+	}
+
+	if (run > 0U) {
+		m_bitBursts++;
+		if (run > m_longestBitBurst)
+			m_longestBitBurst = run;
+	}
+
+	m_n1 += total;
+
+	if (total > 0U) {
+		endGap();
+		m_badRun++;
+	} else {
+		endBurst();
+		m_goodRun++;
+	}
+
+	m_frames++;
+}
+
+void CBERBurst::end()
+{
+	endBurst();
+	endGap();
+}
+
+void CBERBurst::endBurst()
+{
+	if (m_badRun == 0U)
+		return;
+
+	m_bursts++;
+	m_burstFrames += m_badRun;
+	if (m_badRun > m_longestBurst)
+		m_longestBurst = m_badRun;
+
+	m_badRun = 0U;
+}
+
+void CBERBurst::endGap()
+{
+	if (m_goodRun == 0U)
+		return;
+
+	m_gaps++;
+	m_gapFrames += m_goodRun;
+	if (m_goodRun > m_longestGap)
+		m_longestGap = m_goodRun;
+
+	m_goodRun = 0U;
+}
+
+void CBERBurst::dump()
+{
+	if (m_frames == 0U) {
+		::fprintf(stdout, "No error burst data" EOL);
+		return;
+	}
+
+	// Include the runs in progress without ending them
+	unsigned int bursts       = m_bursts + (m_badRun > 0U ? 1U : 0U);
+	unsigned int burstFrames  = m_burstFrames + m_badRun;
+	unsigned int longestBurst = m_badRun > m_longestBurst ? m_badRun : m_longestBurst;
+	unsigned int gaps         = m_gaps + (m_goodRun > 0U ? 1U : 0U);
+	unsigned int gapFrames    = m_gapFrames + m_goodRun;
+	unsigned int longestGap   = m_goodRun > m_longestGap ? m_goodRun : m_longestGap;
+
+	::fprintf(stdout, "Error bursts, frames: %u, errored frame runs: %u (mean %.2f, longest %u), error free runs: %u (mean %.2f, longest %u)" EOL,
+		m_frames,
+		bursts, bursts > 0U ? float(burstFrames) / float(bursts) : 0.0F, longestBurst,
+		gaps, gaps > 0U ? float(gapFrames) / float(gaps) : 0.0F, longestGap);
+
+	::fprintf(stdout, "Errored bit runs: %u (mean %.2f, longest %u)" EOL, m_bitBursts, m_bitBursts > 0U ? float(m_n1) / float(m_bitBursts) : 0.0F, m_longestBitBurst);
+
+	// Gilbert's estimates from a = P(1), b = P(1|1) and c = P(1|1x1), over the checked bits
+	if (m_n11 == 0ULL || m_n1x1 == 0ULL || m_n111 == 0ULL) {
+		::fprintf(stdout, "Gilbert model: not enough clustered errors to fit" EOL);
+		return;
+	}
+
+	double a = double(m_n1) / double(m_n);
+	double b = double(m_n11) / double(m_n1c);
+	double c = double(m_n111) / double(m_n1x1);
+
+	double den = b * c + a * b - 2.0 * a * c;
+	if (den == 0.0) {
+		::fprintf(stdout, "Gilbert model: the errors are not bursty enough to fit" EOL);
+		return;
+	}
+
+	double u = (b * b - a * c) / den;		// P(bad -> bad)
+	double h = b / u;						// P(error | bad)
+	if (u <= 0.0 || u >= 1.0 || h <= a || h > 1.0) {
+		::fprintf(stdout, "Gilbert model: the errors are not bursty enough to fit" EOL);
+		return;
+	}
+
+	double r = 1.0 - u;						// P(bad -> good)
+	double p = a * r / (h - a);				// P(good -> bad)
+
+	::fprintf(stdout, "Gilbert model: P(good->bad): %.6f, P(bad->good): %.6f, BER in bad state: %.3f%%, mean bad state length: %.1f bits" EOL, p, r, h * 100.0, 1.0 / r);
+}
+
+void CBERBurst::reset()
+{
+	m_frames          = 0U;
+	m_badRun          = 0U;
+	m_goodRun         = 0U;
+	m_bursts          = 0U;
+	m_burstFrames     = 0U;
+	m_longestBurst    = 0U;
+	m_gaps            = 0U;
+	m_gapFrames       = 0U;
+	m_longestGap      = 0U;
+	m_bitBursts       = 0U;
+	m_longestBitBurst = 0U;
+	m_n               = 0ULL;
+	m_n1              = 0ULL;
+	m_n1c             = 0ULL;
+	m_n11             = 0ULL;
+	m_n1x1            = 0ULL;
+	m_n111            = 0ULL;
+}
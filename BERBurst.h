@@ -0,0 +1,67 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BERBURST_H)
+#define	BERBURST_H
+
+// Tracks how the errors are clustered, both as runs of errored and error
+// free frames, and as runs of adjacent errored bits within a frame. A two
+// state Gilbert model, where the good state is error free, is fitted from
+// the bit pattern counts. Everything is kept as running totals so no
+// history is stored.
+class CBERBurst {
+public:
+	CBERBurst();
+	~CBERBurst();
+
+	// The errors are a bit map of the frame, in the same bit order as the
+	// frame, and checked has the bits that the FEC can find errors in set,
+	// or is NULL if every bit is checked. Only checked bits, and pairs of
+	// neighbouring checked bits, are counted for the Gilbert model.
+	void add(const unsigned char* errors, const unsigned char* checked, unsigned int bits);
+
+	// The end of a transmission, runs do not continue into the next one
+	void end();
+
+	void dump();
+	void reset();
+
+private:
+	unsigned int       m_frames;
+	unsigned int       m_badRun;
+	unsigned int       m_goodRun;
+	unsigned int       m_bursts;
+	unsigned int       m_burstFrames;
+	unsigned int       m_longestBurst;
+	unsigned int       m_gaps;
+	unsigned int       m_gapFrames;
+	unsigned int       m_longestGap;
+	unsigned int       m_bitBursts;
+	unsigned int       m_longestBitBurst;
+	unsigned long long m_n;
+	unsigned long long m_n1;
+	unsigned long long m_n1c;
+	unsigned long long m_n11;
+	unsigned long long m_n1x1;
+	unsigned long long m_n111;
+
+	void endBurst();
+	void endGap();
+};
+
+#endif
@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2010,2014,2016,2018,2023 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2010,2014,2016,2018,2023,2026 by Jonathan Naylor G4KLX
  *   Copyright (C) 2018 by Andy Uribe CA6JAU
  *   Copyright (C) 2018 by Bryan Biedenkapp N2PLL
  *   Copyright (C) 2016 Mathias Weyland, HB9FRV
@@ -20,6 +20,7 @@
  */
 
 #include "BERCal.h"
+#include "BitUtils.h"
 #include "Hamming.h"
 #include "Golay24128.h"
 #include "P25Utils.h"
@@ -32,6 +33,7 @@
 #include <cstdio>
 #include <cassert>
 #include <cstring>
+#include <cstdint>
 
 #if defined(_WIN32) || defined(_WIN64)
 #define EOL	"\n"
@@ -40,10 +42,19 @@
 #define	EOL	"\r\n"
 #endif
 
-const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U};
 
-#define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
-#define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
+// Inverting a GMSK signal flips every bit, inverting a 4FSK signal swaps
+// +3 with -3 and +1 with -1, which flips the first bit of each dibit
+const unsigned char GMSK_INVERT = 0xFFU;
+const unsigned char C4FSK_INVERT = 0xAAU;
+
+// A failed FICH or LICH check counts the same as this many sync bit errors
+const unsigned int POLARITY_CHECK_ERRORS = 8U;
+
+// The start of the first VCH section in a YSF V/D mode 2 frame
+const unsigned int YSF_VCH_START_BITS = (YSF_SYNC_LENGTH_BYTES + YSF_FICH_LENGTH_BYTES) * 8U;
+
+// Where the nine IMBE code words are in a P25 LDU, including the status symbols
 
 const unsigned int DSTAR_A_TABLE[] = {0U,  6U, 12U, 18U, 24U, 30U, 36U, 42U, 48U, 54U, 60U, 66U,
 									  1U,  7U, 13U, 19U, 25U, 31U, 37U, 43U, 49U, 55U, 61U, 67U};
@@ -59,6 +70,7 @@ const unsigned int DMR_B_TABLE[] = {25U, 29U, 33U, 37U, 41U, 45U, 49U, 53U, 57U,
 const unsigned int DMR_C_TABLE[] = {46U, 50U, 54U, 58U, 62U, 66U, 70U,  3U,  7U, 11U, 15U, 19U,
 									23U, 27U, 31U, 35U, 39U, 43U, 47U, 51U, 55U, 59U, 63U, 67U, 71U};
 
+#if !defined(SMALL_TABLES)
 const unsigned int PRNG_TABLE[] = {
 	0x42CC47U, 0x19D6FEU, 0x304729U, 0x6B2CD0U, 0x60BF47U, 0x39650EU, 0x7354F1U, 0xEACF60U, 0x819C9FU, 0xDE25CEU, 
 	0xD7B745U, 0x8CC8B8U, 0x8D592BU, 0xF71257U, 0xBCA084U, 0xA5B329U, 0xEE6AFAU, 0xF7D9A7U, 0xBCC21CU, 0x4712D9U, 
@@ -470,16 +482,112 @@ const unsigned int PRNG_TABLE[] = {
 	0x70C98FU, 0x0958DCU, 0x02A343U, 0x58B0A2U, 0x150A7DU, 0x0E5BC4U, 0x6FC897U, 0x74F33AU, 0x3F23E9U, 0x66A834U, 
 	0xECDB0FU, 0xB542DAU, 0x9E5131U, 0xC7ABA5U, 0x8C38FEU, 0x97010BU, 0xDED290U, 0xA4CC7DU, 0xAD3D2EU, 0xF6B6B3U, 
 	0xF9A540U, 0x205ED9U, 0x634EB6U, 0x5A9567U, 0x11A6D8U, 0x0B3F09U};
+#endif
+
+// The 24 bit PRNG sequence that whitens the second code word of an AMBE
+// frame, taken from the top bit of each step of the generator
+static inline unsigned int ambe_prng(unsigned int data)
+{
+	assert(data < 4096U);
 
-const unsigned int INTERLEAVE_TABLE_26_4[] = {
-	0U, 4U,  8U, 12U, 16U, 20U, 24U, 28U, 32U, 36U, 40U, 44U, 48U, 52U, 56U, 60U, 64U, 68U, 72U, 76U, 80U, 84U, 88U, 92U, 96U, 100U,
-	1U, 5U,  9U, 13U, 17U, 21U, 25U, 29U, 33U, 37U, 41U, 45U, 49U, 53U, 57U, 61U, 65U, 69U, 73U, 77U, 81U, 85U, 89U, 93U, 97U, 101U,
-	2U, 6U, 10U, 14U, 18U, 22U, 26U, 30U, 34U, 38U, 42U, 46U, 50U, 54U, 58U, 62U, 66U, 70U, 74U, 78U, 82U, 86U, 90U, 94U, 98U, 102U,
-	3U, 7U, 11U, 15U, 19U, 23U, 27U, 31U, 35U, 39U, 43U, 47U, 51U, 55U, 59U, 63U, 67U, 71U, 75U, 79U, 83U, 87U, 91U, 95U, 99U, 103U};
+#if defined(SMALL_TABLES)
+	unsigned int p = 16U * data;
+	unsigned int prng = 0U;
+
+	for (unsigned int i = 0U; i < 24U; i++) {
+		p = (173U * p + 13849U) % 65536U;
+		prng = (prng << 1) | (p >> 15);
+	}
+
+	return prng;
+#else
+	return PRNG_TABLE[data];
+#endif
+}
+
+// A VCH is interleaved as 4 rows of 26 bits, so bit n is sent at position
+// (n % 26) * 4 + n / 26. These are the positions of the first, second and
+// third copies of the 27 repeated bits, which are bits 3i, 3i + 1 and 3i + 2
+const unsigned int YSF_VCH_COPY_TABLE[3U][27U] = {
+	{0U, 12U, 24U, 36U, 48U, 60U, 72U, 84U,  96U,  5U, 17U, 29U, 41U, 53U, 65U, 77U, 89U, 101U, 10U, 22U, 34U, 46U, 58U, 70U, 82U, 94U,  3U},
+	{4U, 16U, 28U, 40U, 52U, 64U, 76U, 88U, 100U,  9U, 21U, 33U, 45U, 57U, 69U, 81U, 93U,   2U, 14U, 26U, 38U, 50U, 62U, 74U, 86U, 98U,  7U},
+	{8U, 20U, 32U, 44U, 56U, 68U, 80U, 92U,   1U, 13U, 25U, 37U, 49U, 61U, 73U, 85U, 97U,   6U, 18U, 30U, 42U, 54U, 66U, 78U, 90U, 102U, 11U}};
 
 const unsigned char WHITENING_DATA[] = {0x93U, 0xD7U, 0x51U, 0x21U, 0x9CU, 0x2FU, 0x6CU, 0xD0U, 0xEFU, 0x0FU,
 										0xF8U, 0x3DU, 0xF1U, 0x73U, 0x20U, 0x94U, 0xEDU, 0x1EU, 0x7CU, 0xD8U};
 
+// The lengths of the eight code words of an IMBE frame
+const unsigned int IMBE_LENGTHS[] = {23U, 23U, 23U, 23U, 15U, 15U, 15U, 7U};
+
+// The 114 bit whitening sequence of c1 to c6 for a value of c0, as two
+// words laid out as c1:c2:c4 and c3:c5:c6 so that no code word is split.
+// The small build works it out for each frame rather than keep a table, so
+// the generator is run as four interleaved sequences, each taking four steps
+// at once, which don't wait on each other.
+static void imbe_whitening_masks(unsigned int c0data, uint64_t* masks)
+{
+	assert(c0data < 4096U);
+	assert(masks != NULL);
+
+	// The first four steps from 16 * c0
+	unsigned int p0 = (173U   * 16U * c0data + 13849U) & 0xFFFFU;
+	unsigned int p1 = (29929U * 16U * c0data + 50430U) & 0xFFFFU;
+	unsigned int p2 = (373U   * 16U * c0data + 21951U) & 0xFFFFU;
+	unsigned int p3 = (64529U * 16U * c0data + 10284U) & 0xFFFFU;
+
+	// The top bits of 116 steps, the first 64 and then 52
+	uint64_t first  = 0U;
+	uint64_t second = 0U;
+	for (unsigned int i = 0U; i < 29U; i++) {
+		uint64_t& bits = i < 16U ? first : second;
+		bits = (bits << 4) | ((p0 >> 15) << 3) | ((p1 >> 15) << 2) | ((p2 >> 15) << 1) | (p3 >> 15);
+
+		p0 = (64529U * p0 + 10284U) & 0xFFFFU;
+		p1 = (64529U * p1 + 10284U) & 0xFFFFU;
+		p2 = (64529U * p2 + 10284U) & 0xFFFFU;
+		p3 = (64529U * p3 + 10284U) & 0xFFFFU;
+	}
+
+	uint64_t c1 = first >> 41;
+	uint64_t c2 = (first >> 18) & 0x7FFFFFU;
+	uint64_t c3 = ((first & 0x3FFFFU) << 5) | (second >> 47);
+	uint64_t c4 = (second >> 32) & 0x7FFFU;
+	uint64_t c5 = (second >> 17) & 0x7FFFU;
+	uint64_t c6 = (second >> 2) & 0x7FFFU;
+
+	masks[0U] = (c1 << 38) | (c2 << 15) | c4;
+	masks[1U] = (c3 << 30) | (c5 << 15) | c6;
+}
+
+#if !defined(SMALL_TABLES)
+// The whitening masks for every value of c0
+class CIMBEWhitening {
+public:
+	CIMBEWhitening()
+	{
+		for (unsigned int c0data = 0U; c0data < 4096U; c0data++)
+			imbe_whitening_masks(c0data, m_masks[c0data]);
+	}
+
+	const uint64_t* get(unsigned int c0data) const
+	{
+		assert(c0data < 4096U);
+
+		return m_masks[c0data];
+	}
+
+private:
+	uint64_t m_masks[4096U][2U];
+};
+
+static const CIMBEWhitening& imbe_whitening()
+{
+	static const CIMBEWhitening w;
+
+	return w;
+}
+#endif
+
 const unsigned int IMBE_INTERLEAVE[] = {
 	0,  7, 12, 19, 24, 31, 36, 43, 48, 55, 60, 67, 72, 79, 84, 91,  96, 103, 108, 115, 120, 127, 132, 139,
 	1,  6, 13, 18, 25, 30, 37, 42, 49, 54, 61, 66, 73, 78, 85, 90,  97, 102, 109, 114, 121, 126, 133, 138,
@@ -488,6 +596,86 @@ const unsigned int IMBE_INTERLEAVE[] = {
 	4, 11, 16, 23, 28, 35, 40, 47, 52, 59, 64, 71, 76, 83, 88, 95, 100, 107, 112, 119, 124, 131, 136, 143,
 	5, 10, 17, 22, 29, 34, 41, 46, 53, 58, 65, 70, 77, 82, 89, 94, 101, 106, 113, 118, 125, 130, 137, 142 };
 
+// The interleave repeats every three bytes, which give four bits to each of
+// the six 24 bit rows that c0 to c7 are read from. Each byte is looked up as
+// the bits that it gives to the rows, in a byte lane for each row, and six
+// bytes fill the lanes with eight bits of every row. The lanes of a pair of
+// rows are 24 bits apart, so the rows are put together with masks.
+class CIMBEDeinterleave {
+public:
+	CIMBEDeinterleave()
+	{
+		unsigned int lanes[24U];
+		for (unsigned int i = 0U; i < 24U; i++)
+			lanes[i] = 64U;
+
+		for (unsigned int i = 0U; i < 144U; i++) {
+			unsigned int n   = IMBE_INTERLEAVE[i];
+			unsigned int row = i / 24U;
+			unsigned int bit = (i % 24U) - 4U * (n / 24U);
+			assert(bit < 4U);
+
+			unsigned int lane = 8U * (row / 2U) + ((row % 2U) == 0U ? 31U : 7U) - bit;
+			assert(lanes[n % 24U] == 64U || lanes[n % 24U] == lane);
+
+			lanes[n % 24U] = lane;
+		}
+
+		for (unsigned int i = 0U; i < 3U; i++) {
+			for (unsigned int v = 0U; v < 256U; v++) {
+				m_table[i][v] = 0U;
+
+				for (unsigned int j = 0U; j < 8U; j++) {
+					if ((v & (0x80U >> j)) != 0U)
+						m_table[i][v] |= uint64_t(1U) << lanes[i * 8U + j];
+				}
+			}
+		}
+	}
+
+	// De-interleave into c0 to c7, each MSB first
+	void gather(const unsigned char* bytes, unsigned int* c) const
+	{
+		assert(bytes != NULL);
+		assert(c != NULL);
+
+		uint64_t lanes[3U];
+		for (unsigned int i = 0U; i < 3U; i++, bytes += 6U) {
+			uint64_t first  = m_table[0U][bytes[0U]] | m_table[1U][bytes[1U]] | m_table[2U][bytes[2U]];
+			uint64_t second = m_table[0U][bytes[3U]] | m_table[1U][bytes[4U]] | m_table[2U][bytes[5U]];
+
+			lanes[i] = first | (second >> 4);
+		}
+
+		// The rows in pairs, each 48 bits of the de-interleaved frame
+		const uint64_t MASK = 0xFF0000FF0000U;
+
+		uint64_t rows[3U];
+		rows[0U] = ((lanes[0U] << 16) & MASK) | ((lanes[1U] << 8) & (MASK >> 8)) | (lanes[2U] & (MASK >> 16));
+		rows[1U] = ((lanes[0U] << 8) & MASK)  | (lanes[1U] & (MASK >> 8))        | ((lanes[2U] >> 8) & (MASK >> 16));
+		rows[2U] = (lanes[0U] & MASK)         | ((lanes[1U] >> 8) & (MASK >> 8)) | ((lanes[2U] >> 16) & (MASK >> 16));
+
+		c[0U] = (unsigned int)(rows[0U] >> 25);
+		c[1U] = (unsigned int)(rows[0U] >> 2) & 0x7FFFFFU;
+		c[2U] = (unsigned int)(((rows[0U] & 0x03U) << 21) | (rows[1U] >> 27));
+		c[3U] = (unsigned int)(rows[1U] >> 4) & 0x7FFFFFU;
+		c[4U] = (unsigned int)(((rows[1U] & 0x0FU) << 11) | (rows[2U] >> 37));
+		c[5U] = (unsigned int)(rows[2U] >> 22) & 0x7FFFU;
+		c[6U] = (unsigned int)(rows[2U] >> 7) & 0x7FFFU;
+		c[7U] = (unsigned int)rows[2U] & 0x7FU;
+	}
+
+private:
+	uint64_t m_table[3U][256U];
+};
+
+static const CIMBEDeinterleave& imbe_deinterleave()
+{
+	static const CIMBEDeinterleave d;
+
+	return d;
+}
+
 // Voice LC MS Header, CC: 1, srcID: 1, dstID: TG9
 const unsigned char VH_DMO1K[] = {
 	0x00U, 0x20U, 0x08U, 0x08U, 0x02U, 0x38U, 0x15U, 0x00U, 0x2CU, 0xA0U, 0x14U,
@@ -521,19 +709,56 @@ const unsigned char VOICE_1K[6][33] = {
 	 0xFEU, 0x83U, 0xA1U, 0x10U, 0x00U, 0x00U, 0x00U, 0x0EU, 0x2CU, 0xC4U, 0x58U, 
 	 0x20U, 0x0AU, 0xCEU, 0xA8U, 0xFEU, 0x83U, 0xACU, 0xC4U, 0x58U, 0x20U, 0x0AU}};
 
-const unsigned char NXDN_SCRAMBLER[] = {
-	0x00U, 0x00U, 0x00U, 0x82U, 0xA0U, 0x88U, 0x8AU, 0x00U, 0xA2U, 0xA8U, 0x82U, 0x8AU, 0x82U, 0x02U,
-	0x20U, 0x08U, 0x8AU, 0x20U, 0xAAU, 0xA2U, 0x82U, 0x08U, 0x22U, 0x8AU, 0xAAU, 0x08U, 0x28U, 0x88U,
-	0x28U, 0x28U, 0x00U, 0x0AU, 0x02U, 0x82U, 0x20U, 0x28U, 0x82U, 0x2AU, 0xAAU, 0x20U, 0x22U, 0x80U,
-	0xA8U, 0x8AU, 0x08U, 0xA0U, 0xAAU, 0x02U};
-
 CBERCal::CBERCal():
 m_errors(0U),
 m_bits(0U),
 m_frames(0U),
-m_timeout(300U),
-m_timer(0U)
+m_stopWatch(),
+m_timeout(1500U),
+m_deadline(0ULL),
+m_dmr1K(33U, 6U),
+m_errorMap(CBERP25::FRAME_BYTES * 8U),
+m_burst(),
+m_rssi(),
+m_dstarAMBE(),
+m_dmrAMBE(),
+m_dmrSplitAMBE(),
+m_ysfVCH(),
+m_ysfViterbi()
 {
+	for (unsigned int i = 0U; i < 6U; i++)
+		m_dmr1K.add(VOICE_1K[i]);
+
+	m_dstarAMBE.add(DSTAR_A_TABLE, 24U);
+	m_dstarAMBE.add(DSTAR_B_TABLE, 24U);
+	m_dstarAMBE.compile();
+
+	m_dmrAMBE.add(DMR_A_TABLE, 24U);
+	m_dmrAMBE.add(DMR_B_TABLE, 23U);
+	m_dmrAMBE.add(DMR_C_TABLE, 25U);
+	m_dmrAMBE.compile();
+
+	// The second AMBE frame of a DMR burst starts at bit 72 and is split by the 48 bits at 108
+	m_dmrSplitAMBE.add(DMR_A_TABLE, 24U, 0U, 36U, 48U);
+	m_dmrSplitAMBE.add(DMR_B_TABLE, 23U, 0U, 36U, 48U);
+	m_dmrSplitAMBE.add(DMR_C_TABLE, 25U, 0U, 36U, 48U);
+	m_dmrSplitAMBE.compile();
+
+	// The NXDN AMBE frames are laid out as a DMR one, each with its own part of the scrambler
+	for (unsigned int i = 0U; i < 4U; i++)
+		m_dmrAMBE.getXor(NXDN_SCRAMBLER + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + i * 9U, m_nxdnXor[i]);
+
+	// Each copy of the 27 repeated bits of a VCH in its own word, un-whitened
+	// as they are gathered, so the whitening is reordered to match
+	unsigned char whitening[11U];
+	::memset(whitening, 0x00U, 11U);
+	for (unsigned int k = 0U; k < 3U; k++) {
+		for (unsigned int i = 0U; i < 27U; i++)
+			CBitUtils::writeBit(whitening, k * 27U + i, CBitUtils::readBit(WHITENING_DATA, i * 3U + k));
+
+		m_ysfVCH.add(YSF_VCH_COPY_TABLE[k], 27U);
+	}
+	m_ysfVCH.compile(NULL, whitening);
 }
 
 CBERCal::~CBERCal()
@@ -542,160 +767,42 @@ CBERCal::~CBERCal()
 
 void CBERCal::DSTARFEC(const unsigned char* buffer, const unsigned char m_tag)
 {
-	unsigned int a = 0U;
-	unsigned int b = 0U;
-	unsigned int c = 0U;
-
-	if (m_tag == 0x10U) {
-		::fprintf(stdout, "D-Star voice header received" EOL);
-		timerStart();
-		m_errors = 0U;
-		m_bits = 0U;
-		m_frames = 0U;
-		return;
-	} else if (m_tag == 0x13U) {
-		if (m_bits > 0U)
-			::fprintf(stdout, "D-Star voice end received, total frames: %d, bits: %d, errors: %d, BER: %.5f%%" EOL, m_frames, m_bits, m_errors, float(m_errors * 100U) / float(m_bits));
-
-		timerStop();
-		m_errors = 0U;
-		m_bits = 0U;
-		m_frames = 0U;
-		return;
-	} else if (m_tag == 0x11U) {
-		timerStart();
-		unsigned int MASK = 0x800000U;
-		for (unsigned int i = 0U; i < 24U; i++) {
-			if (READ_BIT(buffer, DSTAR_A_TABLE[i]))
-				a |= MASK;
-			if (READ_BIT(buffer, DSTAR_B_TABLE[i]))
-				b |= MASK;
-			if (READ_BIT(buffer, DSTAR_C_TABLE[i]))
-				c |= MASK;
-			MASK >>= 1;
-		}
-
-		unsigned int errors = regenerateDStar(a, b);
-
-		m_bits += 48U;
-		m_errors += errors;
-		m_frames++;
-
-		::fprintf(stdout, "D-Star audio FEC BER %% (errs): %.3f%% (%u/48)" EOL, float(errors) / 0.48F, errors);
-	}
+	if (m_tag == 0x10U)
+		FEC<CBERDStar>(BE_HEADER, buffer, m_tag);
+	else if (m_tag == 0x13U)
+		FEC<CBERDStar>(BE_END, buffer, m_tag);
+	else if (m_tag == 0x11U)
+		FEC<CBERDStar>(BE_VOICE, buffer, m_tag);
 }
 
 void CBERCal::DMRFEC(const unsigned char* buffer, const unsigned char m_seq)
 {
-	if (m_seq == 65U) {
-		::fprintf(stdout, "DMR voice header received" EOL);
-		timerStart();
-		m_errors = 0U;
-		m_bits = 0U;
-		m_frames = 0U;
-		return;
-	} else if (m_seq == 66U) {
-		if (m_bits > 0U)
-			::fprintf(stdout, "DMR voice end received, total frames: %d, bits: %d, errors: %d, BER: %.4f%%" EOL, m_frames, m_bits, m_errors, float(m_errors * 100U) / float(m_bits));
-
-		timerStop();
-		m_errors = 0U;
-		m_bits = 0U;
-		m_frames = 0U;
-		return;
-	}
-
-	timerStart();
-
-	unsigned int a1 = 0U, a2 = 0U, a3 = 0U;
-	unsigned int MASK = 0x800000U;
-	for (unsigned int i = 0U; i < 24U; i++, MASK >>= 1) {
-		unsigned int a1Pos = DMR_A_TABLE[i];
-		unsigned int a2Pos = a1Pos + 72U;
-		if (a2Pos >= 108U)
-			a2Pos += 48U;
-		unsigned int a3Pos = a1Pos + 192U;
-
-		if (READ_BIT(buffer, a1Pos))
-			a1 |= MASK;
-		if (READ_BIT(buffer, a2Pos))
-			a2 |= MASK;
-		if (READ_BIT(buffer, a3Pos))
-			a3 |= MASK;
-	}
-
-	unsigned int b1 = 0U, b2 = 0U, b3 = 0U;
-	MASK = 0x400000U;
-	for (unsigned int i = 0U; i < 23U; i++, MASK >>= 1) {
-		unsigned int b1Pos = DMR_B_TABLE[i];
-		unsigned int b2Pos = b1Pos + 72U;
-		if (b2Pos >= 108U)
-			b2Pos += 48U;
-		unsigned int b3Pos = b1Pos + 192U;
-
-		if (READ_BIT(buffer, b1Pos))
-			b1 |= MASK;
-		if (READ_BIT(buffer, b2Pos))
-			b2 |= MASK;
-		if (READ_BIT(buffer, b3Pos))
-			b3 |= MASK;
-	}
-
-	unsigned int c1 = 0U, c2 = 0U, c3 = 0U;
-	MASK = 0x1000000U;
-	for (unsigned int i = 0U; i < 25U; i++, MASK >>= 1) {
-		unsigned int c1Pos = DMR_C_TABLE[i];
-		unsigned int c2Pos = c1Pos + 72U;
-		if (c2Pos >= 108U)
-			c2Pos += 48U;
-		unsigned int c3Pos = c1Pos + 192U;
-
-		if (READ_BIT(buffer, c1Pos))
-			c1 |= MASK;
-		if (READ_BIT(buffer, c2Pos))
-			c2 |= MASK;
-		if (READ_BIT(buffer, c3Pos))
-			c3 |= MASK;
-	}
-
-	unsigned int errors = regenerateDMR(a1, b1, c1);
-	errors += regenerateDMR(a2, b2, c2);
-	errors += regenerateDMR(a3, b3, c3);
-
-	float dmr_ber = float(errors) / 1.41F;
-
-	m_errors += errors;
-	m_bits += 141;
-	m_frames++;
-
-	if (dmr_ber < 10.0F)
-		::fprintf(stdout, "DMR audio seq. %d, FEC BER %% (errs): %.3f%% (%u/141)" EOL, m_seq & 0x0FU, dmr_ber, errors);
+	if (m_seq == 65U)
+		FEC<CBERDMR>(BE_HEADER, buffer, m_seq);
+	else if (m_seq == 66U)
+		FEC<CBERDMR>(BE_END, buffer, m_seq);
+	else
+		FEC<CBERDMR>(BE_VOICE, buffer, m_seq);
 }
 
 void CBERCal::DMR1K(const unsigned char *buffer, const unsigned char m_seq)
 {
-	unsigned int errors = 0;
+	unsigned int errors = 0U;
 	unsigned char dmr_seq = m_seq & 0x0FU;
 
 	if (m_seq == 65U) {
-		for (unsigned int i = 0U; i < 33U; i++)
-			errors += countErrs(buffer[i], VH_DMO1K[i]);
+		errors = CBERPattern::compare(buffer, VH_DMO1K, 33U);
 
 		timerStart();
-		m_errors += errors;
-		m_bits += 264;
-		m_frames++;
+		addFrame(264U, errors);
 
 		::fprintf(stdout, "DMR voice header received, 1031 Test Pattern BER %% (errs): %.3f%% (%u/264)" EOL, float(errors) / 2.64F, errors);
 		return;
 	} else if (m_seq == 66U) {
-		for (unsigned int i = 0U; i < 33U; i++)
-			errors += countErrs(buffer[i], VT_DMO1K[i]);
+		errors = CBERPattern::compare(buffer, VT_DMO1K, 33U);
 
 		timerStop();
-		m_errors += errors;
-		m_bits += 264;
-		m_frames++;
+		addFrame(264U, errors);
 
 		if (m_bits > 0U)
 			::fprintf(stdout, "DMR voice end received, total frames: %d, bits: %d, errors: %d, BER: %.4f%%" EOL, m_frames, m_bits, m_errors, float(m_errors * 100U) / float(m_bits));
@@ -703,102 +810,47 @@ void CBERCal::DMR1K(const unsigned char *buffer, const unsigned char m_seq)
 		return;
 	}
 
-	if (dmr_seq > 5U)
-		dmr_seq = 5U;
-
 	timerStart();
 
-	for (unsigned int i = 0U; i < 33U; i++)
-		errors += countErrs(buffer[i], VOICE_1K[dmr_seq][i]);
+	// Don't trust the sequence number from the modem, use the best matching phase of the pattern
+	unsigned int phase = 0U;
+	errors = m_dmr1K.compare(buffer, phase);
+
+	unsigned char map[CBERDMR::FRAME_BYTES];
+	for (unsigned int i = 0U; i < CBERDMR::FRAME_BYTES; i++)
+		map[i] = buffer[i] ^ VOICE_1K[phase][i];
+
+	// Every bit is compared against the pattern
+	addErrors("DMR 1031 Hz", map, NULL, CBERDMR::FRAME_BYTES * 8U);
 
 	float dmr_ber = float(errors) / 2.64F;
 
-	m_errors += errors;
-	m_bits += 264;
-	m_frames++;
+	addFrame(264U, errors);
 
-	if (dmr_ber < 10.0F)
-		::fprintf(stdout, "DMR audio seq. %d, 1031 Test Pattern BER %% (errs): %.3f%% (%u/264)" EOL, dmr_seq, dmr_ber, errors);
+	if (dmr_ber < 10.0F) {
+		if (phase != dmr_seq)
+			::fprintf(stdout, "DMR audio seq. %u (modem seq. %d), 1031 Test Pattern BER %% (errs): %.3f%% (%u/264)" EOL, phase, dmr_seq, dmr_ber, errors);
+		else
+			::fprintf(stdout, "DMR audio seq. %u, 1031 Test Pattern BER %% (errs): %.3f%% (%u/264)" EOL, phase, dmr_ber, errors);
+	}
 }
 
 void CBERCal::YSFFEC(const unsigned char* buffer)
 {
 	CYSFFICH fich;
-	bool valid = fich.decode(buffer);
-
-	if (valid) {
-		unsigned char fi = fich.getFI();
-		unsigned char dt = fich.getDT();
-
-		if (fi == YSF_FI_HEADER) {
-			::fprintf(stdout, "YSF voice header received" EOL);
-			timerStart();
-			m_errors = 0U;
-			m_bits = 0U;
-			m_frames = 0U;
-			return;
-		} else if (fi == YSF_FI_TERMINATOR) {
-			if (m_bits > 0U)
-				::fprintf(stdout, "YSF voice end received, total frames: %d, bits: %d, errors: %d, BER: %.5f%%" EOL, m_frames, m_bits, m_errors, float(m_errors * 100U) / float(m_bits));
-
-			timerStop();
-			m_errors = 0U;
-			m_bits = 0U;
-			m_frames = 0U;
-			return;
-		} else if (fi == YSF_FI_COMMUNICATIONS && dt == YSF_DT_VD_MODE2) {
-			buffer += YSF_SYNC_LENGTH_BYTES + YSF_FICH_LENGTH_BYTES;
-
-			timerStart();
-
-			unsigned int errors = 0U;
-			unsigned int offset = 40U; // DCH(0)
-
-			// We have a total of 5 VCH sections, iterate through each
-			for (unsigned int j = 0U; j < 5U; j++, offset += 144U) {
-				unsigned int errs = 0U;
-
-				unsigned char vch[13U];
-
-				// Deinterleave
-				for (unsigned int i = 0U; i < 104U; i++) {
-					unsigned int n = INTERLEAVE_TABLE_26_4[i];
-					bool s = READ_BIT(buffer, offset + n);
-					WRITE_BIT(vch, i, s);
-				}
-
-				// "Un-whiten" (descramble)
-				for (unsigned int i = 0U; i < 13U; i++)
-					vch[i] ^= WHITENING_DATA[i];
-
-				for (unsigned int i = 0U; i < 81U; i += 3) {
-					unsigned char vote = 0U;
-					vote += READ_BIT(vch, i + 0U) ? 1U : 0U;
-					vote += READ_BIT(vch, i + 1U) ? 1U : 0U;
-					vote += READ_BIT(vch, i + 2U) ? 1U : 0U;
-
-					switch (vote) {
-					case 1U:		// 1 0 0, or 0 1 0, or 0 0 1
-						errs++;
-						break;
-					case 2U:		// 1 1 0, or 0 1 1, or 1 0 1
-						errs++;
-						break;
-					default:	// 0U (0 0 0), or 3U (1 1 1), no errors
-						break;
-					}
-				}
+	bool valid = fich.decode(buffer, m_ysfViterbi);
+	if (!valid)
+		return;
 
-				errors += errs;
-			}
-	
-			m_bits += 405U;
-			m_errors += errors;
-			m_frames++;
+	unsigned char fi = fich.getFI();
+	unsigned char dt = fich.getDT();
 
-			::fprintf(stdout, "YSF, V/D Mode 2, Repetition FEC BER %% (errs): %.3f%% (%u/405)" EOL, float(errors) / 4.05F, errors);
-		}
-	}
+	if (fi == YSF_FI_HEADER)
+		FEC<CBERYSF>(BE_HEADER, buffer, fi);
+	else if (fi == YSF_FI_TERMINATOR)
+		FEC<CBERYSF>(BE_END, buffer, fi);
+	else if (fi == YSF_FI_COMMUNICATIONS && dt == YSF_DT_VD_MODE2)
+		FEC<CBERYSF>(BE_VOICE, buffer, fi);
 }
 
 void CBERCal::P25FEC(const unsigned char* buffer)
@@ -807,237 +859,348 @@ void CBERCal::P25FEC(const unsigned char* buffer)
 	CP25Utils::decode(buffer, nid, 48U, 114U);
 	unsigned char duid = nid[1U] & 0x0FU;
 
-	unsigned int errs = 0U;
-	unsigned char imbe[18U];
+	if (duid == 0x00U)
+		FEC<CBERP25>(BE_HEADER, buffer, duid);
+	else if (duid == 0x03U)
+		FEC<CBERP25>(BE_END, buffer, duid);
+	else if (duid == 0x05U || duid == 0x0AU)
+		FEC<CBERP25>(BE_VOICE, buffer, duid);
+}
+
+void CBERCal::NXDNFEC(const unsigned char* buffer, const unsigned char m_tag)
+{
+	CNXDNLICH lich;
+	bool valid = lich.decode(buffer, true);
+	if (!valid || !m_tag)
+		return;
+
+	unsigned char usc = lich.getFCT();
+	unsigned char opt = lich.getOption();
+
+	// The same frame starts and ends a transmission
+	if (usc == NXDN_LICH_USC_SACCH_NS)
+		FEC<CBERNXDN>(m_frames == 0U ? BE_HEADER : BE_END, buffer, m_tag);
+	else if (opt == NXDN_LICH_STEAL_NONE)
+		FEC<CBERNXDN>(BE_VOICE, buffer, m_tag);
+}
+
+template <class P>
+void CBERCal::FEC(BER_EVENT event, const unsigned char* buffer, unsigned char tag)
+{
+	assert(buffer != NULL);
 
-	if (duid == 0x00U) {
-		::fprintf(stdout, "P25 HDU received" EOL);
+	switch (event) {
+	case BE_HEADER:
+		::fprintf(stdout, "%s" EOL, P::header());
 		timerStart();
-		m_bits = 0U;
 		m_errors = 0U;
+		m_bits = 0U;
 		m_frames = 0U;
-		return;
-	}
-	else if (duid == 0x03U) {
+		break;
+
+	case BE_END:
 		if (m_bits > 0U)
-			::fprintf(stdout, "P25 TDU received, total frames: %d, bits: %d, errors: %d, BER: %.4f%%" EOL, m_frames, m_bits, m_errors, float(m_errors * 100U) / float(m_bits));
+			::fprintf(stdout, "%s, total frames: %d, bits: %d, errors: %d, BER: %.*f%%" EOL, P::end(), m_frames, m_bits, m_errors, int(P::PRECISION), float(m_errors * 100U) / float(m_bits));
 
 		timerStop();
-		m_bits = 0U;
 		m_errors = 0U;
+		m_bits = 0U;
 		m_frames = 0U;
-		return;
-	}
-	else if (duid == 0x05U) {
-		timerStart();
+		break;
+
+	default: {
+			timerStart();
 
-		CP25Utils::decode(buffer, imbe, 114U, 262U);
-		errs += regenerateIMBE(imbe);
+			unsigned char map[P::FRAME_BYTES];
+			::memset(map, 0x00U, P::FRAME_BYTES);
 
-		CP25Utils::decode(buffer, imbe, 262U, 410U);
-		errs += regenerateIMBE(imbe);
+			unsigned int errors = decodeVoice(P(), buffer, tag, map);
 
-		CP25Utils::decode(buffer, imbe, 452U, 600U);
-		errs += regenerateIMBE(imbe);
+			addErrors(P::name(), map, checkedBits<P>(), P::FRAME_BYTES * 8U);
+
+			addFrame(P::FEC_BITS, errors);
+
+			float ber = float(errors * 100U) / float(P::FEC_BITS);
+			if (!P::QUIET || ber < 10.0F) {
+				char label[40U];
+				P::label(label, tag);
+
+				::fprintf(stdout, "%s FEC BER %% (errs): %.3f%% (%u/%u)" EOL, label, ber, errors, P::FEC_BITS);
+			}
+		}
+		break;
+	}
+}
 
-		CP25Utils::decode(buffer, imbe, 640U, 788U);
-		errs += regenerateIMBE(imbe);
+template <class P>
+const unsigned char* CBERCal::checkedBits()
+{
+	class CCheckedBits {
+	public:
+		CCheckedBits()
+		{
+			::memset(m_map, 0x00U, P::FRAME_BYTES);
+			CBERCal::markChecked(P(), m_map);
+		}
 
-		CP25Utils::decode(buffer, imbe, 830U, 978U);
-		errs += regenerateIMBE(imbe);
+		unsigned char m_map[P::FRAME_BYTES];
+	};
 
-		CP25Utils::decode(buffer, imbe, 1020U, 1168U);
-		errs += regenerateIMBE(imbe);
+	static const CCheckedBits checked;
 
-		CP25Utils::decode(buffer, imbe, 1208U, 1356U);
-		errs += regenerateIMBE(imbe);
+	return checked.m_map;
+}
 
-		CP25Utils::decode(buffer, imbe, 1398U, 1546U);
-		errs += regenerateIMBE(imbe);
+void CBERCal::markChecked(CBERDStar, unsigned char* map)
+{
+	markErrors(map, 0xFFFFFFU, 24U, DSTAR_A_TABLE, 0U);
+	markErrors(map, 0xFFFFFFU, 24U, DSTAR_B_TABLE, 0U);
+}
 
-		CP25Utils::decode(buffer, imbe, 1578U, 1726U);
-		errs += regenerateIMBE(imbe);
+void CBERCal::markChecked(CBERDMR, unsigned char* map)
+{
+	markErrors(map, 0xFFFFFFU, 24U, DMR_A_TABLE, 0U);
+	markErrors(map, 0x7FFFFFU, 23U, DMR_B_TABLE, 0U);
+	markErrors(map, 0xFFFFFFU, 24U, DMR_A_TABLE, 72U, 108U, 48U);
+	markErrors(map, 0x7FFFFFU, 23U, DMR_B_TABLE, 72U, 108U, 48U);
+	markErrors(map, 0xFFFFFFU, 24U, DMR_A_TABLE, 192U);
+	markErrors(map, 0x7FFFFFU, 23U, DMR_B_TABLE, 192U);
+}
 
-		float ber = float(errs) / 12.33F;
-		if (ber < 10.0F)
-			::fprintf(stdout, "P25 LDU1 audio FEC BER %% (errs): %.3f%% (%u/1233)" EOL, ber, errs);
+void CBERCal::markChecked(CBERYSF, unsigned char* map)
+{
+	unsigned int offset = 40U; // DCH(0)
 
-		m_bits += 1233U;
-		m_errors += errs;
-		m_frames++;
+	for (unsigned int j = 0U; j < 5U; j++, offset += 144U) {
+		for (unsigned int k = 0U; k < 3U; k++)
+			markErrors(map, 0x7FFFFFFU, 27U, YSF_VCH_COPY_TABLE[k], YSF_VCH_START_BITS + offset);
 	}
-	else if (duid == 0x0AU) {
-		timerStart();
-
-		CP25Utils::decode(buffer, imbe, 114U, 262U);
-		errs += regenerateIMBE(imbe);
+}
 
-		CP25Utils::decode(buffer, imbe, 262U, 410U);
-		errs += regenerateIMBE(imbe);
+// The parity of each IMBE frame, c7, isn't checked
+void CBERCal::markChecked(CBERP25, unsigned char* map)
+{
+	unsigned char imbe[P25_LDU_IMBE_FRAMES * P25_IMBE_LENGTH_BYTES];
+	::memset(imbe, 0x00U, P25_LDU_IMBE_FRAMES * P25_IMBE_LENGTH_BYTES);
+
+	for (unsigned int n = 0U; n < P25_LDU_IMBE_FRAMES; n++) {
+		const unsigned int* table = IMBE_INTERLEAVE;
+		for (unsigned int i = 0U; i < 7U; i++) {
+			markErrors(imbe + n * P25_IMBE_LENGTH_BYTES, (1U << IMBE_LENGTHS[i]) - 1U, IMBE_LENGTHS[i], table, 0U);
+			table += IMBE_LENGTHS[i];
+		}
+	}
 
-		CP25Utils::decode(buffer, imbe, 452U, 600U);
-		errs += regenerateIMBE(imbe);
+	CP25Utils::encodeLDU(imbe, map);
+}
 
-		CP25Utils::decode(buffer, imbe, 640U, 788U);
-		errs += regenerateIMBE(imbe);
+void CBERCal::markChecked(CBERNXDN, unsigned char* map)
+{
+	for (unsigned int i = 0U; i < 4U; i++) {
+		unsigned int offset = NXDN_FSW_LICH_SACCH_LENGTH_BYTES + i * 9U;
 
-		CP25Utils::decode(buffer, imbe, 830U, 978U);
-		errs += regenerateIMBE(imbe);
+		markErrors(map + offset, 0xFFFFFFU, 24U, DMR_A_TABLE, 0U);
+		markErrors(map + offset, 0x7FFFFFU, 23U, DMR_B_TABLE, 0U);
+	}
+}
 
-		CP25Utils::decode(buffer, imbe, 1020U, 1168U);
-		errs += regenerateIMBE(imbe);
+unsigned int CBERCal::decodeVoice(CBERDStar, const unsigned char* buffer, unsigned char, unsigned char* map)
+{
+	unsigned int errsA, errsB;
+	unsigned int errors = decodeDStar(buffer, errsA, errsB);
 
-		CP25Utils::decode(buffer, imbe, 1208U, 1356U);
-		errs += regenerateIMBE(imbe);
+	markErrors(map, errsA, 24U, DSTAR_A_TABLE, 0U);
+	markErrors(map, errsB, 24U, DSTAR_B_TABLE, 0U);
 
-		CP25Utils::decode(buffer, imbe, 1398U, 1546U);
-		errs += regenerateIMBE(imbe);
+	return errors;
+}
 
-		CP25Utils::decode(buffer, imbe, 1578U, 1726U);
-		errs += regenerateIMBE(imbe);
+unsigned int CBERCal::decodeVoice(CBERDMR, const unsigned char* buffer, unsigned char, unsigned char* map)
+{
+	unsigned int errs[6U];
+	unsigned int errors = decodeDMR(buffer, errs);
 
-		float ber = float(errs) / 12.33F;
-		if (ber < 10.0F)
-			::fprintf(stdout, "P25 LDU2 audio FEC BER %% (errs): %.3f%% (%u/1233)" EOL, ber, errs);
+	// The second AMBE frame is split by the sync or embedded signalling
+	markErrors(map, errs[0U], 24U, DMR_A_TABLE, 0U);
+	markErrors(map, errs[1U], 23U, DMR_B_TABLE, 0U);
+	markErrors(map, errs[2U], 24U, DMR_A_TABLE, 72U, 108U, 48U);
+	markErrors(map, errs[3U], 23U, DMR_B_TABLE, 72U, 108U, 48U);
+	markErrors(map, errs[4U], 24U, DMR_A_TABLE, 192U);
+	markErrors(map, errs[5U], 23U, DMR_B_TABLE, 192U);
 
-		m_bits += 1233U;
-		m_errors += errs;
-		m_frames++;
-	}
+	return errors;
 }
 
-void CBERCal::NXDNFEC(const unsigned char* buffer, const unsigned char m_tag)
+unsigned int CBERCal::decodeVoice(CBERYSF, const unsigned char* buffer, unsigned char, unsigned char* map)
 {
-	unsigned char data[NXDN_FRAME_LENGTH_BYTES];
+	buffer += YSF_SYNC_LENGTH_BYTES + YSF_FICH_LENGTH_BYTES;
 
-	::memcpy(data, buffer, NXDN_FRAME_LENGTH_BYTES);
+	unsigned int errors = 0U;
+	unsigned int offset = 40U; // DCH(0)
 
-	NXDNScrambler(data);
+	// We have a total of 5 VCH sections, iterate through each
+	for (unsigned int j = 0U; j < 5U; j++, offset += 144U) {
+		// Deinterleave and "un-whiten" (descramble) into the three copies
+		unsigned int copies[3U];
+		m_ysfVCH.gather(buffer + offset / 8U, copies);
 
-	CNXDNLICH lich;
-	bool valid = lich.decode(data);
-
-	if (valid && m_tag) {
-		unsigned char usc = lich.getFCT();
-		unsigned char opt = lich.getOption();
-
-		if (usc == NXDN_LICH_USC_SACCH_NS) {
-			if (m_frames == 0U) {
-				::fprintf(stdout, "NXDN voice header received" EOL);
-				timerStart();
-				m_errors = 0U;
-				m_bits = 0U;
-				m_frames = 0U;
-				return;
-			} else {
-				if (m_bits > 0U)
-					::fprintf(stdout, "NXDN voice end received, total frames: %d, bits: %d, errors: %d, BER: %.5f%%" EOL, m_frames, m_bits, m_errors, float(m_errors * 100U) / float(m_bits));
-
-				timerStop();
-				m_errors = 0U;
-				m_bits = 0U;
-				m_frames = 0U;
-				return;
-			}
-		} else if (opt == NXDN_LICH_STEAL_NONE) {
-			timerStart();
+		unsigned int a = copies[0U];
+		unsigned int b = copies[1U];
+		unsigned int c = copies[2U];
 
-			unsigned int errors = 0U;
-			errors += regenerateYSFDN(data + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 0U);
-			errors += regenerateYSFDN(data + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 9U);
-			errors += regenerateYSFDN(data + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 18U);
-			errors += regenerateYSFDN(data + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + 27U);
+		// A repeated bit is in error if its copies disagree, and the copy
+		// that differs from the other two is the bit in error
+		errors += CBitUtils::countBits((a ^ b) | (b ^ c));
 
-			m_bits += 188U;
-			m_errors += errors;
-			m_frames++;
+		unsigned int vote = (a & b) | (b & c) | (a & c);
 
-			::fprintf(stdout, "NXDN audio FEC BER %% (errs): %.3f%% (%u/188)" EOL, float(errors) / 1.88F, errors);
-		}
+		markErrors(map, a ^ vote, 27U, YSF_VCH_COPY_TABLE[0U], YSF_VCH_START_BITS + offset);
+		markErrors(map, b ^ vote, 27U, YSF_VCH_COPY_TABLE[1U], YSF_VCH_START_BITS + offset);
+		markErrors(map, c ^ vote, 27U, YSF_VCH_COPY_TABLE[2U], YSF_VCH_START_BITS + offset);
 	}
-}
 
-void CBERCal::NXDNScrambler(unsigned char* data)
-{
-	for (unsigned int i = 0U; i < NXDN_FRAME_LENGTH_BYTES; i++)
-		data[i] ^= NXDN_SCRAMBLER[i];
+	return errors;
 }
 
-unsigned int CBERCal::regenerateDStar(unsigned int& a, unsigned int& b)
+unsigned int CBERCal::decodeVoice(CBERP25, const unsigned char* buffer, unsigned char, unsigned char* map)
 {
-	unsigned int orig_a = a;
-	unsigned int orig_b = b;
+	unsigned char nid[P25_NID_LENGTH_BYTES];
+	unsigned char imbe[P25_LDU_IMBE_FRAMES * P25_IMBE_LENGTH_BYTES];
+	CP25Utils::decodeLDU(buffer, nid, imbe);
 
-	unsigned int data = CGolay24128::decode24128(a);
+	unsigned int errors = 0U;
 
-	a = CGolay24128::encode24128(data);
+	unsigned char imbeErrs[P25_LDU_IMBE_FRAMES * P25_IMBE_LENGTH_BYTES];
+	for (unsigned int i = 0U; i < P25_LDU_IMBE_FRAMES; i++)
+		errors += regenerateIMBE(imbe + i * P25_IMBE_LENGTH_BYTES, imbeErrs + i * P25_IMBE_LENGTH_BYTES);
 
-	// The PRNG
-	unsigned int p = PRNG_TABLE[data];
+	CP25Utils::encodeLDU(imbeErrs, map);
 
-	b ^= p;
+	return errors;
+}
 
-	unsigned int datb = CGolay24128::decode24128(b);
+unsigned int CBERCal::decodeVoice(CBERNXDN, const unsigned char* buffer, unsigned char, unsigned char* map)
+{
+	// The AMBE frames are descrambled as they are extracted
+	unsigned int errors = 0U;
+	for (unsigned int i = 0U; i < 4U; i++) {
+		unsigned int offset = NXDN_FSW_LICH_SACCH_LENGTH_BYTES + i * 9U;
 
-	b = CGolay24128::encode24128(datb);
+		unsigned int words[3U];
+		m_dmrAMBE.gather(buffer + offset, m_nxdnXor[i], words);
+		errors += regenerateYSFDN(words, map + offset);
+	}
 
-	b ^= p;
+	return errors;
+}
 
-	unsigned int errsA = 0U, errsB = 0U;
+unsigned int CBERCal::decodeDStar(const unsigned char* buffer, unsigned int& errsA, unsigned int& errsB)
+{
+	assert(buffer != NULL);
 
-	unsigned int v = a ^ orig_a;
-	while (v != 0U) {
-		v &= v - 1U;
-		errsA++;
-	}
+	unsigned int words[2U];
+	m_dstarAMBE.gather(buffer, words);
 
-	v = b ^ orig_b;
-	while (v != 0U) {
-		v &= v - 1U;
-		errsB++;
-	}
+	return regenerateDStar(words[0U], words[1U], errsA, errsB);
+}
+
+unsigned int CBERCal::decodeDMR(const unsigned char* buffer, unsigned int* errs)
+{
+	assert(buffer != NULL);
+	assert(errs != NULL);
+
+	// The three AMBE frames start at bits 0, 72 and 192
+	unsigned int words[9U];
+	m_dmrAMBE.gather(buffer, words + 0U);
+	m_dmrSplitAMBE.gather(buffer + 9U, words + 3U);
+	m_dmrAMBE.gather(buffer + 24U, words + 6U);
 
-	return errsA + errsB;
+	unsigned int errors = regenerateDMR(words[0U], words[1U], words[2U], errs[0U], errs[1U]);
+	errors += regenerateDMR(words[3U], words[4U], words[5U], errs[2U], errs[3U]);
+	errors += regenerateDMR(words[6U], words[7U], words[8U], errs[4U], errs[5U]);
+
+	return errors;
 }
 
-unsigned int CBERCal::regenerateDMR(unsigned int& a, unsigned int& b, unsigned int& c)
+unsigned int CBERCal::regenerateDStar(unsigned int a, unsigned int b, unsigned int& errsA, unsigned int& errsB)
 {
-	unsigned int orig_a = a;
-	unsigned int orig_b = b;
+	unsigned int data = CGolay24128::correct24128(a, errsA);
+
+	// The PRNG
+	unsigned int p = ambe_prng(data);
+
+	CGolay24128::correct24128(b ^ p, errsB);
 
-	unsigned int data = CGolay24128::decode24128(a);
+	return CBitUtils::countBits(errsA) + CBitUtils::countBits(errsB);
+}
 
-	a = CGolay24128::encode24128(data);
+unsigned int CBERCal::regenerateDMR(unsigned int a, unsigned int b, unsigned int c, unsigned int& errsA, unsigned int& errsB)
+{
+	unsigned int data = CGolay24128::correct24128(a, errsA);
 
 	// The PRNG
-	unsigned int p = PRNG_TABLE[data] >> 1;
+	unsigned int p = ambe_prng(data) >> 1;
 
-	b ^= p;
+	CGolay24128::correct23127(b ^ p, errsB);
 
-	unsigned int datb = CGolay24128::decode23127(b);
+	return CBitUtils::countBits(errsA) + CBitUtils::countBits(errsB);
+}
 
-	b = CGolay24128::encode23127(datb) >> 1;
+unsigned int CBERCal::regenerateIMBE(const unsigned char* bytes, unsigned char* errors)
+{
+	assert(bytes != NULL);
+	assert(errors != NULL);
 
-	b ^= p;
+	unsigned int c[8U];
+	imbe_deinterleave().gather(bytes, c);
 
-	unsigned int errsA = 0U, errsB = 0U;
+	// Process the c0 section first to allow the de-whitening to be accurate
+	unsigned int pattern[7U];
+	unsigned int c0data = CGolay24128::correct23127(c[0U], pattern[0U]);
 
-	unsigned int v = a ^ orig_a;
-	while (v != 0U) {
-		v &= v - 1U;
-		errsA++;
+	// De-whiten c1 to c6, the errors are the same in either domain
+#if defined(SMALL_TABLES)
+	uint64_t mask[2U];
+	imbe_whitening_masks(c0data, mask);
+#else
+	const uint64_t* mask = imbe_whitening().get(c0data);
+#endif
+	c[1U] ^= (unsigned int)(mask[0U] >> 38) & 0x7FFFFFU;
+	c[2U] ^= (unsigned int)(mask[0U] >> 15) & 0x7FFFFFU;
+	c[3U] ^= (unsigned int)(mask[1U] >> 30) & 0x7FFFFFU;
+	c[4U] ^= (unsigned int)(mask[0U] >> 0)  & 0x7FFFU;
+	c[5U] ^= (unsigned int)(mask[1U] >> 15) & 0x7FFFU;
+	c[6U] ^= (unsigned int)(mask[1U] >> 0)  & 0x7FFFU;
+
+	// c1, c2 and c3
+	for (unsigned int i = 1U; i < 4U; i++)
+		CGolay24128::correct23127(c[i], pattern[i]);
+
+	// c4, c5 and c6, a Hamming (15,11,3) decoder corrects at most one bit
+	for (unsigned int i = 4U; i < 7U; i++) {
+		pattern[i] = c[i];
+		CHamming::decode15113_1(c[i]);
+		pattern[i] ^= c[i];
 	}
 
-	v = b ^ orig_b;
-	while (v != 0U) {
-		v &= v - 1U;
-		errsB++;
+	// Put the errors back into the interleaved order
+	::memset(errors, 0x00U, 18U);
+
+	unsigned int count = 0U;
+	const unsigned int* table = IMBE_INTERLEAVE;
+	for (unsigned int i = 0U; i < 7U; i++) {
+		table += IMBE_LENGTHS[i];
+
+		// Counted as they are marked, most words have no errors
+		for (unsigned int bits = pattern[i]; bits != 0U; bits &= bits - 1U, count++)
+			CBitUtils::setBit(errors, *(table - 1U - CBitUtils::lowestBit(bits)));
 	}
 
-	return errsA + errsB;
+	return count;
 }
 
-unsigned int CBERCal::regenerateIMBE(const unsigned char* bytes)
+// The original bool array version of regenerateIMBE(), kept as a reference for it
+unsigned int CBERCal::regenerateIMBEReference(const unsigned char* bytes)
 {
 	assert(bytes != NULL);
 
@@ -1047,7 +1210,7 @@ unsigned int CBERCal::regenerateIMBE(const unsigned char* bytes)
 	// De-interleave
 	for (unsigned int i = 0U; i < 144U; i++) {
 		unsigned int n = IMBE_INTERLEAVE[i];
-		orig[i] = temp[i] = READ_BIT(bytes, n);
+		orig[i] = temp[i] = CBitUtils::readBit(bytes, n);
 	}
 
 	// now ..
@@ -1165,41 +1328,79 @@ unsigned int CBERCal::regenerateIMBE(const unsigned char* bytes)
 	return errors;
 }
 
-unsigned int CBERCal::regenerateYSFDN(unsigned char* bytes)
+unsigned int CBERCal::regenerateYSFDN(const unsigned int* words, unsigned char* map)
 {
-	unsigned int a = 0U;
-	unsigned int MASK = 0x800000U;
-	for (unsigned int i = 0U; i < 24U; i++, MASK >>= 1) {
-		unsigned int aPos = DMR_A_TABLE[i];
-		if (READ_BIT(bytes, aPos))
-			a |= MASK;
-	}
+	assert(words != NULL);
+	assert(map != NULL);
 
-	unsigned int b = 0U;
-	MASK = 0x400000U;
-	for (unsigned int i = 0U; i < 23U; i++, MASK >>= 1) {
-		unsigned int bPos = DMR_B_TABLE[i];
-		if (READ_BIT(bytes, bPos))
-			b |= MASK;
-	}
+	unsigned int errsA, errsB;
+	unsigned int errors = regenerateDMR(words[0U], words[1U], words[2U], errsA, errsB);
+
+	markErrors(map, errsA, 24U, DMR_A_TABLE, 0U);
+	markErrors(map, errsB, 23U, DMR_B_TABLE, 0U);
+
+	return errors;
+}
+
+void CBERCal::addFrame(unsigned int bits, unsigned int errors)
+{
+	m_bits   += bits;
+	m_errors += errors;
+	m_frames++;
+
+	m_rssi.addFrame(m_stopWatch.time(), bits, errors);
+}
+
+void CBERCal::addErrors(const char* name, const unsigned char* errors, const unsigned char* checked, unsigned int bits)
+{
+	assert(name != NULL);
+	assert(errors != NULL);
+
+	// The burst statistics are not comparable across modes either
+	if (m_errorMap.setLayout(name, bits))
+		m_burst.reset();
 
-	unsigned int c = 0U;
-	MASK = 0x1000000U;
-	for (unsigned int i = 0U; i < 25U; i++, MASK >>= 1) {
-		unsigned int cPos = DMR_C_TABLE[i];
-		if (READ_BIT(bytes, cPos))
-			c |= MASK;
+	m_errorMap.add(errors);
+
+	m_burst.add(errors, checked, bits);
+}
+
+void CBERCal::markErrors(unsigned char* map, unsigned int pattern, unsigned int length, const unsigned int* table, unsigned int offset, unsigned int gapPos, unsigned int gapLength)
+{
+	assert(map != NULL);
+	assert(table != NULL);
+
+	// The pattern is MSB first, as the code words are assembled, only the set bits are visited
+	while (pattern != 0U) {
+		unsigned int bit = CBitUtils::lowestBit(pattern);
+		pattern &= pattern - 1U;
+
+		unsigned int pos = table[length - 1U - bit] + offset;
+		if (pos >= gapPos)
+			pos += gapLength;
+
+		CBitUtils::setBit(map, pos);
 	}
+}
 
-	return regenerateDMR(a, b, c);
+void CBERCal::dumpErrorMap()
+{
+	m_errorMap.dump();
+	m_burst.dump();
+}
+
+void CBERCal::resetErrorMap()
+{
+	m_errorMap.reset();
+	m_burst.reset();
+
+	::fprintf(stdout, "Bit error map cleared" EOL);
 }
 
 void CBERCal::clock()
 {
-	if (m_timer > 0U && m_timeout > 0U) {
-		m_timer += 1U;
-		
-		if (m_timer >= m_timeout) {
+	if (m_deadline > 0ULL) {
+		if (m_stopWatch.time() >= m_deadline) {
 			if (m_bits > 0U)
 				::fprintf(stdout, "Transmission lost, total frames: %d, bits: %d, errors: %d, BER: %.5f%%" EOL, m_frames, m_bits, m_errors, float(m_errors * 100U) / float(m_bits));
 
@@ -1211,27 +1412,169 @@ void CBERCal::clock()
 	}
 }
 
-void CBERCal::timerStart()
+void CBERCal::RSSI(unsigned int rssi)
 {
-	if (m_timeout > 0U)
-		m_timer = 1U;
+	m_rssi.addRSSI(m_stopWatch.time(), rssi);
 }
 
-void CBERCal::timerStop()
+bool CBERCal::startRSSI(const char* fileName)
 {
-	m_timer = 0U;
+	if (!m_rssi.start(fileName))
+		return false;
+
+	if (fileName != NULL)
+		::fprintf(stdout, "BER against RSSI measurement started, logging to %s" EOL, fileName);
+	else
+		::fprintf(stdout, "BER against RSSI measurement started" EOL);
+
+	return true;
 }
 
-unsigned char CBERCal::countErrs(unsigned char a, unsigned char b)
+void CBERCal::stopRSSI()
 {
-	int cnt = 0;
-	unsigned char tmp = a ^ b;
+	m_rssi.stop();
 
-	while (tmp) {
-		if (tmp % 2 == 1)
-			cnt++;
-		tmp /= 2;
-	}
+	::fprintf(stdout, "BER against RSSI measurement stopped" EOL);
+
+	m_rssi.dump();
+}
+
+bool CBERCal::isRSSIRunning() const
+{
+	return m_rssi.isRunning();
+}
+
+unsigned int CBERCal::getTableBytes() const
+{
+	unsigned int bytes = m_dstarAMBE.getTableBytes() + m_dmrAMBE.getTableBytes() + m_dmrSplitAMBE.getTableBytes() +
+						 m_ysfVCH.getTableBytes() + sizeof(CIMBEDeinterleave);
+
+	bytes += sizeof(m_nxdnXor);
+
+#if !defined(SMALL_TABLES)
+	bytes += sizeof(PRNG_TABLE) + sizeof(CIMBEWhitening);
+#endif
+
+	return bytes;
+}
+
+int CBERCal::DSTARPolarity(const unsigned char* buffer)
+{
+	assert(buffer != NULL);
+
+	unsigned char inverted[CBERDStar::FRAME_BYTES];
+	invert(buffer, inverted, CBERDStar::FRAME_BYTES, GMSK_INVERT);
+
+	// The all ones word is a Golay code word, so an inverted A word decodes
+	// cleanly and it is the B word, scrambled from the A word's data, that is scored
+	unsigned int errsA, errsB;
+	int normalErrs = int(decodeDStar(buffer, errsA, errsB));
+	int invertedErrs = int(decodeDStar(inverted, errsA, errsB));
+
+	return normalErrs - invertedErrs;
+}
+
+int CBERCal::DMRPolarity(const unsigned char* buffer)
+{
+	assert(buffer != NULL);
+
+	unsigned char inverted[CBERDMR::FRAME_BYTES];
+	invert(buffer, inverted, CBERDMR::FRAME_BYTES, C4FSK_INVERT);
+
+	unsigned int errs[6U];
+	int normalErrs = int(decodeDMR(buffer, errs));
+	int invertedErrs = int(decodeDMR(inverted, errs));
+
+	return normalErrs - invertedErrs;
+}
+
+// The modem has already matched the sync in the polarity it is using, so it
+// is the Viterbi, Golay and CRC of the FICH that are scored
+int CBERCal::YSFPolarity(const unsigned char* buffer)
+{
+	assert(buffer != NULL);
+
+	unsigned char inverted[YSF_FRAME_LENGTH_BYTES];
+	invert(buffer, inverted, YSF_FRAME_LENGTH_BYTES, C4FSK_INVERT);
+
+	CYSFFICH fich;
+
+	int normalErrs = 0;
+	if (!fich.decode(buffer, m_ysfViterbi))
+		normalErrs += int(POLARITY_CHECK_ERRORS);
+
+	int invertedErrs = 0;
+	if (!fich.decode(inverted, m_ysfViterbi))
+		invertedErrs += int(POLARITY_CHECK_ERRORS);
+
+	return normalErrs - invertedErrs;
+}
+
+// The same for the sync here, so it is the Golay and Hamming words of the
+// IMBE frames in an LDU that are scored
+int CBERCal::P25Polarity(const unsigned char* buffer)
+{
+	assert(buffer != NULL);
+
+	unsigned char inverted[CBERP25::FRAME_BYTES];
+	invert(buffer, inverted, CBERP25::FRAME_BYTES, C4FSK_INVERT);
+
+	unsigned char map[CBERP25::FRAME_BYTES];
+	::memset(map, 0x00U, CBERP25::FRAME_BYTES);
+
+	int normalErrs = int(decodeVoice(CBERP25(), buffer, 0U, map));
+	int invertedErrs = int(decodeVoice(CBERP25(), inverted, 0U, map));
+
+	return normalErrs - invertedErrs;
+}
+
+// The same for the FSW, so it is the LICH parity and, in voice frames, the
+// Golay words of the AMBE frames that are scored
+int CBERCal::NXDNPolarity(const unsigned char* buffer)
+{
+	assert(buffer != NULL);
+
+	unsigned char inverted[NXDN_FRAME_LENGTH_BYTES];
+	invert(buffer, inverted, NXDN_FRAME_LENGTH_BYTES, C4FSK_INVERT);
+
+	unsigned char map[NXDN_FRAME_LENGTH_BYTES];
+	::memset(map, 0x00U, NXDN_FRAME_LENGTH_BYTES);
+
+	CNXDNLICH lich;
+
+	int normalErrs = 0;
+	if (!lich.decode(buffer, true))
+		normalErrs += int(POLARITY_CHECK_ERRORS);
+	else if (lich.getFCT() != NXDN_LICH_USC_SACCH_NS && lich.getOption() == NXDN_LICH_STEAL_NONE)
+		normalErrs += int(decodeVoice(CBERNXDN(), buffer, 0U, map));
+
+	int invertedErrs = 0;
+	if (!lich.decode(inverted, true))
+		invertedErrs += int(POLARITY_CHECK_ERRORS);
+	else if (lich.getFCT() != NXDN_LICH_USC_SACCH_NS && lich.getOption() == NXDN_LICH_STEAL_NONE)
+		invertedErrs += int(decodeVoice(CBERNXDN(), inverted, 0U, map));
+
+	return normalErrs - invertedErrs;
+}
+
+void CBERCal::invert(const unsigned char* in, unsigned char* out, unsigned int length, unsigned char mask)
+{
+	assert(in != NULL);
+	assert(out != NULL);
+
+	for (unsigned int i = 0U; i < length; i++)
+		out[i] = in[i] ^ mask;
+}
+
+void CBERCal::timerStart()
+{
+	if (m_timeout > 0U)
+		m_deadline = m_stopWatch.time() + m_timeout;
+}
+
+void CBERCal::timerStop()
+{
+	m_deadline = 0ULL;
 
-	return cnt;
+	m_burst.end();
 }
@@ -20,6 +20,15 @@
 #if !defined(BERCAL_H)
 #define BERCAL_H
 
+#include "BERErrorMap.h"
+#include "BERBurst.h"
+#include "BERPattern.h"
+#include "BERRSSI.h"
+#include "BERProtocol.h"
+#include "BitPermutation.h"
+#include "YSFConvolution.h"
+#include "StopWatch.h"
+
 class CBERCal {
 public:
 	CBERCal();
@@ -34,21 +43,87 @@ public:
 
 	void clock();
 
+	void dumpErrorMap();
+	void resetErrorMap();
+
+	void RSSI(unsigned int rssi);
+
+	// Compare how well a frame decodes as received and with the receive
+	// polarity inverted, positive if the inverted frame fits better
+	int DSTARPolarity(const unsigned char* buffer);
+	int DMRPolarity(const unsigned char* buffer);
+	int YSFPolarity(const unsigned char* buffer);
+	int P25Polarity(const unsigned char* buffer);
+	int NXDNPolarity(const unsigned char* buffer);
+
+	bool startRSSI(const char* fileName);
+	void stopRSSI();
+	bool isRSSIRunning() const;
+
+	// The size of the permutation, PRNG and whitening tables that the decoders use
+	unsigned int getTableBytes() const;
+
 private:
+	// So that the decode steps can be timed, and checked for allocations, on their own
+	friend class CBenchmark;
+
+	CBERCal(const CBERCal&);
+	CBERCal& operator=(const CBERCal&);
+
 	unsigned int m_errors;
 	unsigned int m_bits;
 	unsigned int m_frames;
 
-	unsigned int m_timeout;
-	unsigned int m_timer;
+	CStopWatch         m_stopWatch;
+	unsigned int       m_timeout;		// ms
+	unsigned long long m_deadline;
+
+	CBERPattern        m_dmr1K;
+	CBERErrorMap       m_errorMap;
+	CBERBurst          m_burst;
+	CBERRSSI           m_rssi;
+
+	CBitPermutation    m_dstarAMBE;
+	CBitPermutation    m_dmrAMBE;
+	CBitPermutation    m_dmrSplitAMBE;
+	unsigned int       m_nxdnXor[4U][BIT_PERMUTATION_MAX_WORDS];
+	CBitPermutation    m_ysfVCH;
+
+	// Reused for every FICH so that a YSF frame is decoded without setting one up
+	CYSFConvolution    m_ysfViterbi;
+
+	unsigned int decodeDStar(const unsigned char* buffer, unsigned int& errsA, unsigned int& errsB);
+	unsigned int decodeDMR(const unsigned char* buffer, unsigned int* errs);
+	unsigned int regenerateDStar(unsigned int a, unsigned int b, unsigned int& errsA, unsigned int& errsB);
+	unsigned int regenerateDMR(unsigned int a, unsigned int b, unsigned int c, unsigned int& errsA, unsigned int& errsB);
+	unsigned int regenerateIMBE(const unsigned char* bytes, unsigned char* errors);
+	unsigned int regenerateIMBEReference(const unsigned char* bytes);
+	unsigned int regenerateYSFDN(const unsigned int* words, unsigned char* map);
+
+	// The header, voice frame and end handling shared by every mode
+	template <class P> void FEC(BER_EVENT event, const unsigned char* buffer, unsigned char tag);
+
+	// Returns the errors in a voice frame and marks them in the map
+	unsigned int decodeVoice(CBERDStar, const unsigned char* buffer, unsigned char tag, unsigned char* map);
+	unsigned int decodeVoice(CBERDMR,   const unsigned char* buffer, unsigned char tag, unsigned char* map);
+	unsigned int decodeVoice(CBERYSF,   const unsigned char* buffer, unsigned char tag, unsigned char* map);
+	unsigned int decodeVoice(CBERP25,   const unsigned char* buffer, unsigned char tag, unsigned char* map);
+	unsigned int decodeVoice(CBERNXDN,  const unsigned char* buffer, unsigned char tag, unsigned char* map);
+
+	// Marks every bit of a frame that decodeVoice() could mark as an error
+	static void markChecked(CBERDStar, unsigned char* map);
+	static void markChecked(CBERDMR,   unsigned char* map);
+	static void markChecked(CBERYSF,   unsigned char* map);
+	static void markChecked(CBERP25,   unsigned char* map);
+	static void markChecked(CBERNXDN,  unsigned char* map);
 
-	void NXDNScrambler(unsigned char* data);
-	unsigned int regenerateDStar(unsigned int& a, unsigned int& b);
-	unsigned int regenerateDMR(unsigned int& a, unsigned int& b, unsigned int& c);
-	unsigned int regenerateIMBE(const unsigned char* bytes);
-	unsigned int regenerateYSFDN(unsigned char* bytes);
+	// The map from markChecked(), built on first use
+	template <class P> static const unsigned char* checkedBits();
 
-	unsigned char countErrs(unsigned char a, unsigned char b);
+	void addFrame(unsigned int bits, unsigned int errors);
+	void addErrors(const char* name, const unsigned char* errors, const unsigned char* checked, unsigned int bits);
+	static void markErrors(unsigned char* map, unsigned int pattern, unsigned int length, const unsigned int* table, unsigned int offset, unsigned int gapPos = 0xFFFFFFFFU, unsigned int gapLength = 0U);
+	void invert(const unsigned char* in, unsigned char* out, unsigned int length, unsigned char mask);
 
 	void timerStart();
 	void timerStop();
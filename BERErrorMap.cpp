@@ -0,0 +1,176 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "BERErrorMap.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define EOL	"\n"
+#else
+#define	EOL	"\r\n"
+#endif
+
+// Eight planes count up to 255 frames before they must be flushed
+const unsigned int NUM_OF_PLANES = 8U;
+const unsigned int MAX_PENDING   = (1U << NUM_OF_PLANES) - 1U;
+
+const unsigned int BITS_PER_ROW = 16U;
+
+CBERErrorMap::CBERErrorMap(unsigned int maxBits) :
+m_maxBits(maxBits),
+m_name(""),
+m_bits(0U),
+m_words(0U),
+m_planes(NULL),
+m_pending(0U),
+m_counts(NULL),
+m_frames(0U)
+{
+	assert(maxBits > 0U);
+
+	unsigned int words = (maxBits + 63U) / 64U;
+
+	m_planes = new uint64_t[NUM_OF_PLANES * words];
+	m_counts = new unsigned int[maxBits];
+}
+
+CBERErrorMap::~CBERErrorMap()
+{
+	delete[] m_planes;
+	delete[] m_counts;
+}
+
+bool CBERErrorMap::setLayout(const char* name, unsigned int bits)
+{
+	assert(name != NULL);
+	assert(bits > 0U && bits <= m_maxBits);
+	assert((bits % 8U) == 0U);
+
+	if (bits == m_bits && ::strcmp(name, m_name) == 0)
+		return false;
+
+	m_name  = name;
+	m_bits  = bits;
+	m_words = (bits + 63U) / 64U;
+
+	reset();
+
+	return true;
+}
+
+void CBERErrorMap::add(const unsigned char* errors)
+{
+	assert(errors != NULL);
+	assert(m_bits > 0U);
+
+	unsigned int bytes = m_bits / 8U;
+
+	for (unsigned int w = 0U; w < m_words; w++) {
+		// Load the next 64 bits, first bit of the frame in the MSB
+		uint64_t carry = 0U;
+		for (unsigned int i = 0U; i < 8U; i++) {
+			unsigned int n = w * 8U + i;
+			carry = (carry << 8) | (n < bytes ? errors[n] : 0x00U);
+		}
+
+		// Ripple the new errors through the planes, stops as soon as there is no carry
+		uint64_t* plane = m_planes + w;
+		for (unsigned int k = 0U; k < NUM_OF_PLANES && carry != 0U; k++, plane += m_words) {
+			uint64_t t = *plane & carry;
+			*plane ^= carry;
+			carry = t;
+		}
+	}
+
+	m_frames++;
+	m_pending++;
+
+	if (m_pending >= MAX_PENDING)
+		flush();
+}
+
+void CBERErrorMap::dump()
+{
+	if (m_frames == 0U) {
+		::fprintf(stdout, "No bit error map data" EOL);
+		return;
+	}
+
+	flush();
+
+	unsigned int total = 0U;
+	unsigned int worst = 0U;
+	for (unsigned int i = 0U; i < m_bits; i++) {
+		total += m_counts[i];
+		if (m_counts[i] > m_counts[worst])
+			worst = i;
+	}
+
+	::fprintf(stdout, "%s bit error map, frames: %u, bits per frame: %u, errors: %u, worst position: %u (%u)" EOL, m_name, m_frames, m_bits, total, worst, m_counts[worst]);
+
+	for (unsigned int i = 0U; i < m_bits; i += BITS_PER_ROW) {
+		bool empty = true;
+		for (unsigned int j = i; j < (i + BITS_PER_ROW) && j < m_bits; j++) {
+			if (m_counts[j] > 0U)
+				empty = false;
+		}
+
+		// Don't print rows with no errors, such as the sync
+		if (empty)
+			continue;
+
+		::fprintf(stdout, "%4u:", i);
+		for (unsigned int j = i; j < (i + BITS_PER_ROW) && j < m_bits; j++)
+			::fprintf(stdout, " %5u", m_counts[j]);
+		::fprintf(stdout, EOL);
+	}
+}
+
+void CBERErrorMap::reset()
+{
+	unsigned int words = (m_maxBits + 63U) / 64U;
+
+	::memset(m_planes, 0x00U, NUM_OF_PLANES * words * sizeof(uint64_t));
+	::memset(m_counts, 0x00U, m_maxBits * sizeof(unsigned int));
+
+	m_pending = 0U;
+	m_frames  = 0U;
+}
+
+void CBERErrorMap::flush()
+{
+	if (m_pending == 0U)
+		return;
+
+	for (unsigned int w = 0U; w < m_words; w++) {
+		for (unsigned int k = 0U; k < NUM_OF_PLANES; k++) {
+			uint64_t plane = m_planes[k * m_words + w];
+			m_planes[k * m_words + w] = 0U;
+
+			for (unsigned int b = 0U; plane != 0U && b < 64U; b++, plane <<= 1) {
+				if ((plane & 0x8000000000000000ULL) != 0U)
+					m_counts[w * 64U + b] += 1U << k;
+			}
+		}
+	}
+
+	m_pending = 0U;
+}
@@ -0,0 +1,55 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BERERRORMAP_H)
+#define	BERERRORMAP_H
+
+#include <cstdint>
+
+// Counts bit errors per position within a frame. The counts are kept as
+// vertical (bit-sliced) counters so that adding a frame only costs a few
+// word operations, and they are only spread out into per position totals
+// when the counters are about to overflow or the map is displayed.
+class CBERErrorMap {
+public:
+	CBERErrorMap(unsigned int maxBits);
+	~CBERErrorMap();
+
+	// Changing the layout clears the map, and returns true
+	bool setLayout(const char* name, unsigned int bits);
+
+	// The errors are a bit map of the frame, in the same bit order as the frame
+	void add(const unsigned char* errors);
+
+	void dump();
+	void reset();
+
+private:
+	unsigned int  m_maxBits;
+	const char*   m_name;
+	unsigned int  m_bits;
+	unsigned int  m_words;
+	uint64_t*     m_planes;
+	unsigned int  m_pending;
+	unsigned int* m_counts;
+	unsigned int  m_frames;
+
+	void flush();
+};
+
+#endif
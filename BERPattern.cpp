@@ -0,0 +1,153 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "BERPattern.h"
+#include "BitUtils.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+
+// Phases are compared in groups of four words, 256 bits, at a time
+const unsigned int WORDS_PER_BLOCK = 4U;
+
+const unsigned int MAX_PHASES = 32U;
+
+// The received frame is packed on the stack, so the frames are at most 256 bytes
+const unsigned int MAX_WORDS = 32U;
+
+CBERPattern::CBERPattern(unsigned int length, unsigned int maxPhases) :
+m_length(length),
+m_words(0U),
+m_maxPhases(maxPhases),
+m_phases(0U),
+m_patterns(NULL)
+{
+	assert(length > 0U);
+	assert(maxPhases > 0U && maxPhases <= MAX_PHASES);
+
+	// Round up to a whole number of blocks, the padding is always zero
+	m_words = (length + 7U) / 8U;
+	m_words = ((m_words + WORDS_PER_BLOCK - 1U) / WORDS_PER_BLOCK) * WORDS_PER_BLOCK;
+	assert(m_words <= MAX_WORDS);
+
+	m_patterns = new uint64_t[m_words * maxPhases];
+	::memset(m_patterns, 0x00U, m_words * maxPhases * sizeof(uint64_t));
+}
+
+CBERPattern::~CBERPattern()
+{
+	delete[] m_patterns;
+}
+
+void CBERPattern::add(const unsigned char* pattern)
+{
+	assert(pattern != NULL);
+	assert(m_phases < m_maxPhases);
+
+	pack(pattern, m_patterns + m_phases * m_words, m_length);
+
+	m_phases++;
+}
+
+unsigned int CBERPattern::compare(const unsigned char* data, unsigned int& phase) const
+{
+	assert(data != NULL);
+	assert(m_phases > 0U);
+
+	// The padding up to a whole block is zero, as it is in the patterns
+	uint64_t packed[MAX_WORDS];
+	pack(data, packed, m_length);
+	for (unsigned int w = (m_length + 7U) / 8U; w < m_words; w++)
+		packed[w] = 0U;
+
+	unsigned int errors[MAX_PHASES];
+	for (unsigned int i = 0U; i < m_phases; i++)
+		errors[i] = 0U;
+
+	// A single pass over the frame, each block is checked against every phase while it is hot
+	for (unsigned int w = 0U; w < m_words; w += WORDS_PER_BLOCK) {
+		uint64_t d0 = packed[w + 0U];
+		uint64_t d1 = packed[w + 1U];
+		uint64_t d2 = packed[w + 2U];
+		uint64_t d3 = packed[w + 3U];
+
+		const uint64_t* p = m_patterns + w;
+		for (unsigned int i = 0U; i < m_phases; i++, p += m_words) {
+			errors[i] += CBitUtils::countBits64(d0 ^ p[0U]);
+			errors[i] += CBitUtils::countBits64(d1 ^ p[1U]);
+			errors[i] += CBitUtils::countBits64(d2 ^ p[2U]);
+			errors[i] += CBitUtils::countBits64(d3 ^ p[3U]);
+		}
+	}
+
+	phase = 0U;
+	for (unsigned int i = 1U; i < m_phases; i++) {
+		if (errors[i] < errors[phase])
+			phase = i;
+	}
+
+	return errors[phase];
+}
+
+unsigned int CBERPattern::getBits() const
+{
+	return m_length * 8U;
+}
+
+unsigned int CBERPattern::getPhases() const
+{
+	return m_phases;
+}
+
+unsigned int CBERPattern::compare(const unsigned char* data1, const unsigned char* data2, unsigned int length)
+{
+	assert(data1 != NULL);
+	assert(data2 != NULL);
+
+	unsigned int errors = 0U;
+
+	unsigned int i = 0U;
+	for (; (i + 8U) <= length; i += 8U) {
+		uint64_t v1, v2;
+		::memcpy(&v1, data1 + i, 8U);
+		::memcpy(&v2, data2 + i, 8U);
+		errors += CBitUtils::countBits64(v1 ^ v2);
+	}
+
+	for (; i < length; i++)
+		errors += CBitUtils::countBits64(data1[i] ^ data2[i]);
+
+	return errors;
+}
+
+void CBERPattern::pack(const unsigned char* in, uint64_t* out, unsigned int length)
+{
+	assert(in != NULL);
+	assert(out != NULL);
+
+	// The byte order within a word does not matter for counting errors
+	unsigned int words = length / 8U;
+	::memcpy(out, in, words * 8U);
+
+	unsigned int rest = length - words * 8U;
+	if (rest > 0U) {
+		out[words] = 0U;
+		::memcpy(out + words, in + words * 8U, rest);
+	}
+}
@@ -0,0 +1,54 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BERPATTERN_H)
+#define	BERPATTERN_H
+
+#include <cstdint>
+
+// Compares received frames against a set of known test pattern frames, one
+// per phase of the pattern, and finds the phase that matches best.
+class CBERPattern {
+public:
+	CBERPattern(unsigned int length, unsigned int maxPhases);
+	~CBERPattern();
+
+	void add(const unsigned char* pattern);
+
+	// Returns the bit errors against the best matching phase
+	unsigned int compare(const unsigned char* data, unsigned int& phase) const;
+
+	unsigned int getBits() const;
+	unsigned int getPhases() const;
+
+	static unsigned int compare(const unsigned char* data1, const unsigned char* data2, unsigned int length);
+
+private:
+	CBERPattern(const CBERPattern&);
+	CBERPattern& operator=(const CBERPattern&);
+
+	unsigned int m_length;
+	unsigned int m_words;
+	unsigned int m_maxPhases;
+	unsigned int m_phases;
+	uint64_t*    m_patterns;
+
+	static void pack(const unsigned char* in, uint64_t* out, unsigned int length);
+};
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BERPROTOCOL_H)
+#define	BERPROTOCOL_H
+
+#include "NXDNDefines.h"
+#include "YSFDefines.h"
+#include "P25Utils.h"
+
+#include <cstdio>
+
+// What a received frame does to a BER measurement
+enum BER_EVENT {
+	BE_HEADER,
+	BE_VOICE,
+	BE_END
+};
+
+// Each mode is described by one of these, and CBERCal::FEC is instantiated
+// for each so that the frame sizes are constants in its copy of the code. A
+// new mode needs a descriptor, a CBERCal::decodeVoice overload that finds the
+// errors in a voice frame, and an entry point that turns a frame into an
+// event.
+//
+// FRAME_BYTES  the length of the frame, and of its error map
+// FEC_BITS     the bits checked by the FEC in each voice frame
+// PRECISION    decimal places of the BER printed at the end
+// QUIET        voice frames worse than 10% BER are not printed
+
+// Two Golay (24,12) code words
+class CBERDStar {
+public:
+	static const unsigned int FRAME_BYTES = 12U;
+	static const unsigned int FEC_BITS    = 2U * 24U;
+	static const unsigned int PRECISION   = 5U;
+	static const bool         QUIET       = false;
+
+	static const char* name()   { return "D-Star"; }
+	static const char* header() { return "D-Star voice header received"; }
+	static const char* end()    { return "D-Star voice end received"; }
+
+	static void label(char* text, unsigned char)
+	{
+		::sprintf(text, "D-Star audio");
+	}
+};
+
+// A Golay (24,12) and a Golay (23,12) code word in each of three AMBE frames
+class CBERDMR {
+public:
+	static const unsigned int FRAME_BYTES = 33U;
+	static const unsigned int FEC_BITS    = 3U * (24U + 23U);
+	static const unsigned int PRECISION   = 4U;
+	static const bool         QUIET       = true;
+
+	static const char* name()   { return "DMR"; }
+	static const char* header() { return "DMR voice header received"; }
+	static const char* end()    { return "DMR voice end received"; }
+
+	static void label(char* text, unsigned char seq)
+	{
+		::sprintf(text, "DMR audio seq. %d,", seq & 0x0FU);
+	}
+};
+
+// The 27 repeated bit triplets in each of five VCH sections
+class CBERYSF {
+public:
+	static const unsigned int FRAME_BYTES = YSF_FRAME_LENGTH_BYTES;
+	static const unsigned int FEC_BITS    = 5U * 27U * 3U;
+	static const unsigned int PRECISION   = 5U;
+	static const bool         QUIET       = false;
+
+	static const char* name()   { return "YSF"; }
+	static const char* header() { return "YSF voice header received"; }
+	static const char* end()    { return "YSF voice end received"; }
+
+	static void label(char* text, unsigned char)
+	{
+		::sprintf(text, "YSF, V/D Mode 2, Repetition");
+	}
+};
+
+// Four Golay (23,12) and three Hamming (15,11,3) code words in each of the
+// nine IMBE frames of an LDU, the last seven bits of each are unprotected
+class CBERP25 {
+public:
+	static const unsigned int FRAME_BYTES = 216U;
+	static const unsigned int FEC_BITS    = P25_LDU_IMBE_FRAMES * (4U * 23U + 3U * 15U);
+	static const unsigned int PRECISION   = 4U;
+	static const bool         QUIET       = true;
+
+	static const char* name()   { return "P25"; }
+	static const char* header() { return "P25 HDU received"; }
+	static const char* end()    { return "P25 TDU received"; }
+
+	static void label(char* text, unsigned char duid)
+	{
+		::sprintf(text, "P25 LDU%u audio", duid == 0x05U ? 1U : 2U);
+	}
+};
+
+// A Golay (24,12) and a Golay (23,12) code word in each of four AMBE frames
+class CBERNXDN {
+public:
+	static const unsigned int FRAME_BYTES = NXDN_FRAME_LENGTH_BYTES;
+	static const unsigned int FEC_BITS    = 4U * (24U + 23U);
+	static const unsigned int PRECISION   = 5U;
+	static const bool         QUIET       = false;
+
+	static const char* name()   { return "NXDN"; }
+	static const char* header() { return "NXDN voice header received"; }
+	static const char* end()    { return "NXDN voice end received"; }
+
+	static void label(char* text, unsigned char)
+	{
+		::sprintf(text, "NXDN audio");
+	}
+};
+
+#endif
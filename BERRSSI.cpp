@@ -0,0 +1,174 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "BERRSSI.h"
+
+#include <cassert>
+#include <cstring>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define EOL	"\n"
+#else
+#define	EOL	"\r\n"
+#endif
+
+// The raw RSSI from the modem is a 12-bit ADC value
+const unsigned int RSSI_MAX       = 4096U;
+const unsigned int RSSI_BIN_WIDTH = 32U;
+const unsigned int RSSI_BINS      = RSSI_MAX / RSSI_BIN_WIDTH;
+
+// A frame is only binned if there was an RSSI sample this recently
+const unsigned long long RSSI_MAX_AGE = 1000ULL;	// ms
+
+CBERRSSI::CBERRSSI() :
+m_running(false),
+m_fp(NULL),
+m_start(0ULL),
+m_rssiTime(0ULL),
+m_rssi(0U),
+m_hasRSSI(false),
+m_frames(NULL),
+m_bits(NULL),
+m_errors(NULL),
+m_unbinned(0U)
+{
+	m_frames = new unsigned int[RSSI_BINS];
+	m_bits   = new unsigned int[RSSI_BINS];
+	m_errors = new unsigned int[RSSI_BINS];
+}
+
+CBERRSSI::~CBERRSSI()
+{
+	stop();
+
+	delete[] m_frames;
+	delete[] m_bits;
+	delete[] m_errors;
+}
+
+bool CBERRSSI::start(const char* fileName)
+{
+	stop();
+
+	::memset(m_frames, 0x00U, RSSI_BINS * sizeof(unsigned int));
+	::memset(m_bits,   0x00U, RSSI_BINS * sizeof(unsigned int));
+	::memset(m_errors, 0x00U, RSSI_BINS * sizeof(unsigned int));
+
+	m_unbinned = 0U;
+	m_hasRSSI  = false;
+	m_start    = 0ULL;
+
+	if (fileName != NULL) {
+		m_fp = ::fopen(fileName, "wt");
+		if (m_fp == NULL) {
+			::fprintf(stderr, "Unable to open %s for writing" EOL, fileName);
+			return false;
+		}
+
+		::fprintf(m_fp, "time_ms,type,rssi,bits,errors\n");
+	}
+
+	m_running = true;
+
+	return true;
+}
+
+void CBERRSSI::stop()
+{
+	if (m_fp != NULL) {
+		::fclose(m_fp);
+		m_fp = NULL;
+	}
+
+	m_running = false;
+}
+
+bool CBERRSSI::isRunning() const
+{
+	return m_running;
+}
+
+void CBERRSSI::addRSSI(unsigned long long time, unsigned int rssi)
+{
+	if (!m_running)
+		return;
+
+	if (m_start == 0ULL)
+		m_start = time;
+
+	m_rssiTime = time;
+	m_rssi     = rssi;
+	m_hasRSSI  = true;
+
+	if (m_fp != NULL)
+		::fprintf(m_fp, "%llu,RSSI,%u,,\n", time - m_start, rssi);
+}
+
+void CBERRSSI::addFrame(unsigned long long time, unsigned int bits, unsigned int errors)
+{
+	if (!m_running)
+		return;
+
+	if (m_start == 0ULL)
+		m_start = time;
+
+	bool fresh = m_hasRSSI && (time - m_rssiTime) <= RSSI_MAX_AGE;
+
+	if (m_fp != NULL) {
+		if (fresh)
+			::fprintf(m_fp, "%llu,BER,%u,%u,%u\n", time - m_start, m_rssi, bits, errors);
+		else
+			::fprintf(m_fp, "%llu,BER,,%u,%u\n", time - m_start, bits, errors);
+	}
+
+	if (!fresh) {
+		m_unbinned++;
+		return;
+	}
+
+	unsigned int bin = m_rssi / RSSI_BIN_WIDTH;
+	if (bin >= RSSI_BINS)
+		bin = RSSI_BINS - 1U;
+
+	m_frames[bin]++;
+	m_bits[bin]   += bits;
+	m_errors[bin] += errors;
+}
+
+void CBERRSSI::dump()
+{
+	bool found = false;
+
+	for (unsigned int i = 0U; i < RSSI_BINS; i++) {
+		if (m_frames[i] == 0U)
+			continue;
+
+		if (!found) {
+			::fprintf(stdout, "BER against RSSI:" EOL);
+			found = true;
+		}
+
+		::fprintf(stdout, "    RSSI %4u-%4u, frames: %u, bits: %u, errors: %u, BER: %.5f%%" EOL, i * RSSI_BIN_WIDTH, (i + 1U) * RSSI_BIN_WIDTH - 1U, m_frames[i], m_bits[i], m_errors[i], float(m_errors[i]) * 100.0F / float(m_bits[i]));
+	}
+
+	if (!found)
+		::fprintf(stdout, "No BER frames with an RSSI value" EOL);
+
+	if (m_unbinned > 0U)
+		::fprintf(stdout, "Frames without a recent RSSI value: %u" EOL, m_unbinned);
+}
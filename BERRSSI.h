@@ -0,0 +1,56 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BERRSSI_H)
+#define	BERRSSI_H
+
+#include <cstdio>
+
+// Joins the RSSI samples and the BER frames into a single time ordered
+// stream, optionally logged to a CSV file, and bins the BER of each frame
+// against the latest RSSI as it arrives, so a sensitivity curve can be
+// taken from one sweep of the signal level.
+class CBERRSSI {
+public:
+	CBERRSSI();
+	~CBERRSSI();
+
+	bool start(const char* fileName);
+	void stop();
+
+	bool isRunning() const;
+
+	void addRSSI(unsigned long long time, unsigned int rssi);
+	void addFrame(unsigned long long time, unsigned int bits, unsigned int errors);
+
+	void dump();
+
+private:
+	bool               m_running;
+	FILE*              m_fp;
+	unsigned long long m_start;
+	unsigned long long m_rssiTime;
+	unsigned int       m_rssi;
+	bool               m_hasRSSI;
+	unsigned int*      m_frames;
+	unsigned int*      m_bits;
+	unsigned int*      m_errors;
+	unsigned int       m_unbinned;
+};
+
+#endif
@@ -0,0 +1,1111 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Benchmark.h"
+#include "AllocationCounter.h"
+#include "BERCal.h"
+#include "BERPattern.h"
+#include "BitPermutation.h"
+#include "BitUtils.h"
+#include "CPUDispatch.h"
+#include "CRC.h"
+#include "CRCEngine.h"
+#include "Golay24128.h"
+#include "GolayBatch.h"
+#include "Hamming.h"
+#include "P25Utils.h"
+#include "YSFDefines.h"
+#include "YSFFICH.h"
+#include "Version.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define EOL	"\n"
+#else
+#define	EOL	"\r\n"
+#endif
+
+const unsigned int GOLAY_WORDS  = 4096U;
+const unsigned int GOLAY_ROUNDS = 500U;
+
+const unsigned int BATCH_WORDS  = 65536U;
+const unsigned int BATCH_ROUNDS = 100U;
+
+const unsigned int FICH_FRAMES = 1024U;
+const unsigned int FICH_ROUNDS = 200U;
+
+const unsigned int HAMMING_WORDS  = 4096U;
+const unsigned int HAMMING_ROUNDS = 500U;
+
+const unsigned int PATTERN_FRAMES = 256U;
+const unsigned int PATTERN_ROUNDS = 2000U;
+
+const unsigned int PERMUTATION_FRAMES = 4096U;
+const unsigned int PERMUTATION_ROUNDS = 500U;
+
+const unsigned int IMBE_FRAMES = 4096U;
+const unsigned int IMBE_ROUNDS = 100U;
+
+const unsigned int LDU_FRAMES = 256U;
+const unsigned int LDU_ROUNDS = 200U;
+const unsigned int LDU_LENGTH = 216U;
+
+const unsigned int LDU_IMBE_START[] = {114U, 262U, 452U, 640U,  830U, 1020U, 1208U, 1398U, 1578U};
+const unsigned int LDU_IMBE_STOP[]  = {262U, 410U, 600U, 788U,  978U, 1168U, 1356U, 1546U, 1726U};
+
+const unsigned int VCH_FRAMES = 1024U;
+const unsigned int VCH_ROUNDS = 200U;
+
+const unsigned int ENCODE_FRAMES = 1024U;
+const unsigned int ENCODE_ROUNDS = 500U;
+
+const unsigned int CRC_BUFFER_LENGTH = 4096U;
+const unsigned int CRC_BUFFER_ROUNDS = 20000U;
+
+const unsigned int CRC_HEADERS       = 4096U;
+const unsigned int CRC_HEADER_LENGTH = 41U;
+const unsigned int CRC_HEADER_ROUNDS = 500U;
+
+const unsigned int ALLOCATION_FRAMES = 1000U;
+const unsigned int ALLOCATION_LENGTH = 256U;
+
+const unsigned int FOOTPRINT_ROUNDS = 100U;
+
+// The D-Star header CRC, as used by CCRC::checkCCITT161()
+typedef CCRCEngine<16U, 0x1021U, 0xFFFFU, true, 0xFFFFU> CBenchmarkCRC;
+
+// The A and B code words of a D-Star AMBE frame
+static void dstar_tables(unsigned int* a, unsigned int* b)
+{
+	for (unsigned int i = 0U; i < 12U; i++) {
+		a[i + 0U]  = i * 6U + 0U;
+		a[i + 12U] = i * 6U + 1U;
+		b[i + 0U]  = i * 6U + 2U;
+		b[i + 12U] = i * 6U + 3U;
+	}
+}
+
+// The A, B and C code words of a DMR AMBE frame
+static void dmr_tables(unsigned int* a, unsigned int* b, unsigned int* c)
+{
+	unsigned int n = 0U;
+	for (unsigned int i = 0U; i < 72U; i += 4U)
+		a[n++] = i;
+	for (unsigned int i = 1U; n < 24U; i += 4U)
+		a[n++] = i;
+
+	n = 0U;
+	for (unsigned int i = 25U; i < 72U; i += 4U)
+		b[n++] = i;
+	for (unsigned int i = 2U; n < 23U; i += 4U)
+		b[n++] = i;
+
+	n = 0U;
+	for (unsigned int i = 46U; i < 72U; i += 4U)
+		c[n++] = i;
+	for (unsigned int i = 3U; n < 25U; i += 4U)
+		c[n++] = i;
+}
+
+// The status symbol stripping as it was done before CP25Utils worked on runs of bits
+static void p25_decode_bits(const unsigned char* in, unsigned char* out, unsigned int start, unsigned int stop)
+{
+	unsigned int n = 0U;
+	for (unsigned int i = start; i < stop; i++) {
+		if ((i % 72U) < 70U) {
+			bool b = (in[i / 8U] & (0x80U >> (i % 8U))) != 0U;
+			out[n / 8U] = b ? (out[n / 8U] | (0x80U >> (n % 8U))) : (out[n / 8U] & ~(0x80U >> (n % 8U)));
+			n++;
+		}
+	}
+}
+
+static void p25_encode_bits(const unsigned char* in, unsigned char* out, unsigned int start, unsigned int stop)
+{
+	unsigned int n = 0U;
+	for (unsigned int i = start; i < stop; i++) {
+		if ((i % 72U) < 70U) {
+			bool b = (in[n / 8U] & (0x80U >> (n % 8U))) != 0U;
+			out[i / 8U] = b ? (out[i / 8U] | (0x80U >> (i % 8U))) : (out[i / 8U] & ~(0x80U >> (i % 8U)));
+			n++;
+		}
+	}
+}
+
+CBenchmark::CBenchmark() :
+m_stopWatch(),
+m_random(0x12345678U),
+m_sink(0U)
+{
+}
+
+CBenchmark::~CBenchmark()
+{
+}
+
+int CBenchmark::run()
+{
+	::fprintf(stdout, VERSION " FEC benchmarks" EOL);
+	CCPUDispatch::print();
+
+	golay();
+	syndrome();
+	golayBatch();
+	fich();
+	hamming();
+	pattern();
+	permutation();
+	extract();
+	imbe();
+	ldu();
+	vch();
+	encode();
+	crc();
+	allocations();
+	footprint();
+
+	// Stops the compiler from discarding the work being timed
+	::fprintf(stdout, "Checksum: %08X" EOL, m_sink);
+
+	return 0;
+}
+
+void CBenchmark::golay()
+{
+	// One AMBE frame has three (24,12) and three (23,12) words, an IMBE frame has four (23,12) words
+	unsigned int* words24 = new unsigned int[GOLAY_WORDS];
+	unsigned int* words23 = new unsigned int[GOLAY_WORDS];
+
+	for (unsigned int i = 0U; i < GOLAY_WORDS; i++) {
+		words24[i] = CGolay24128::encode24128(random() & 0xFFFU) ^ randomErrors(24U, 3U);
+		words23[i] = (CGolay24128::encode23127(random() & 0xFFFU) >> 1) ^ randomErrors(23U, 3U);
+	}
+
+	unsigned int frames = GOLAY_WORDS * GOLAY_ROUNDS / 3U;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < GOLAY_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < (GOLAY_WORDS - 2U); i += 3U) {
+			for (unsigned int j = i; j < (i + 3U); j++) {
+				unsigned int a = CGolay24128::decode24128(words24[j]);
+				m_sink += CBitUtils::countBits(words24[j] ^ CGolay24128::encode24128(a));
+
+				unsigned int b = CGolay24128::decode23127(words23[j]);
+				m_sink += CBitUtils::countBits(words23[j] ^ (CGolay24128::encode23127(b) >> 1));
+			}
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < GOLAY_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < (GOLAY_WORDS - 2U); i += 3U) {
+			for (unsigned int j = i; j < (i + 3U); j++) {
+				unsigned int errs;
+				CGolay24128::decode24128(words24[j], errs);
+				m_sink += errs;
+
+				CGolay24128::decode23127(words23[j], errs);
+				m_sink += errs;
+			}
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("AMBE frame BER", "re-encode", oldMS, "syndrome weight", newMS, frames);
+
+	frames = GOLAY_WORDS * GOLAY_ROUNDS / 4U;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < GOLAY_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < GOLAY_WORDS; i++) {
+			unsigned int c = CGolay24128::decode23127(words23[i]);
+			m_sink += CBitUtils::countBits(words23[i] ^ (CGolay24128::encode23127(c) >> 1));
+		}
+	}
+	oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < GOLAY_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < GOLAY_WORDS; i++) {
+			unsigned int errs;
+			CGolay24128::decode23127(words23[i], errs);
+			m_sink += errs;
+		}
+	}
+	newMS = m_stopWatch.elapsed();
+
+	report("IMBE frame Golay BER", "re-encode", oldMS, "syndrome weight", newMS, frames);
+
+	delete[] words24;
+	delete[] words23;
+}
+
+void CBenchmark::syndrome()
+{
+	unsigned int* words = new unsigned int[GOLAY_WORDS];
+	for (unsigned int i = 0U; i < GOLAY_WORDS; i++)
+		words[i] = (CGolay24128::encode23127(random() & 0xFFFU) >> 1) ^ randomErrors(23U, 3U);
+
+	unsigned int count = GOLAY_WORDS * GOLAY_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < GOLAY_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < GOLAY_WORDS; i++)
+			m_sink += CGolay24128::syndrome23127Serial(words[i]);
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < GOLAY_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < GOLAY_WORDS; i++)
+			m_sink += CGolay24128::syndrome23127(words[i]);
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("Golay (23,12) syndrome", "bit serial", oldMS, "byte sliced", newMS, count);
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < GOLAY_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < GOLAY_WORDS; i++)
+			m_sink += CGolay24128::decode23127(words[i]);
+	}
+	oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	bool ok = CGolay24128::setDirectTable(true);
+	unsigned int buildMS = m_stopWatch.elapsed();
+
+	if (!ok) {
+		::fprintf(stdout, "Golay (23,12) decode: no memory for the direct table" EOL);
+		delete[] words;
+		return;
+	}
+
+	// Random code words, as the table is far bigger than the cache
+	for (unsigned int i = 0U; i < GOLAY_WORDS; i++)
+		words[i] = random() & 0x7FFFFFU;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < GOLAY_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < GOLAY_WORDS; i++)
+			m_sink += CGolay24128::decode23127(words[i]);
+	}
+	newMS = m_stopWatch.elapsed();
+
+	CGolay24128::setDirectTable(false);
+
+	report("Golay (23,12) decode", "byte sliced", oldMS, "direct table", newMS, count);
+	::fprintf(stdout, "%-28s built in %u ms, 16 MB" EOL, "Golay (23,12) direct table", buildMS);
+
+	delete[] words;
+}
+
+void CBenchmark::golayBatch()
+{
+	unsigned int* codes  = new unsigned int[BATCH_WORDS];
+	unsigned int* data   = new unsigned int[BATCH_WORDS];
+	unsigned int* errors = new unsigned int[BATCH_WORDS];
+
+	for (unsigned int i = 0U; i < BATCH_WORDS; i++)
+		codes[i] = (CGolay24128::encode23127(random() & 0xFFFU) >> 1) ^ randomErrors(23U, 3U);
+
+	unsigned int count = BATCH_WORDS * BATCH_ROUNDS;
+
+	GOLAY_BATCH_TYPE original = CGolayBatch::getType();
+
+	const GOLAY_BATCH_TYPE types[] = {GBT_TABLE, GBT_SCALAR, GBT_AVX2, GBT_AVX512};
+	for (unsigned int t = 0U; t < 4U; t++) {
+		char name[50U];
+		::sprintf(name, "Golay (23,12) batch %s", CGolayBatch::getName(types[t]));
+
+		if (!CGolayBatch::setType(types[t])) {
+			::fprintf(stdout, "%-28s not supported by this CPU, or turned off" EOL, name);
+			continue;
+		}
+
+		m_stopWatch.start();
+		for (unsigned int n = 0U; n < BATCH_ROUNDS; n++) {
+			CGolayBatch::decode23127(codes, data, errors, BATCH_WORDS);
+			m_sink += data[n] + errors[n];
+		}
+		rate(name, m_stopWatch.elapsed(), count, "code words");
+	}
+
+	CGolayBatch::setType(original);
+
+	delete[] codes;
+	delete[] data;
+	delete[] errors;
+}
+
+void CBenchmark::fich()
+{
+	unsigned char* frames = new unsigned char[FICH_FRAMES * YSF_FRAME_LENGTH_BYTES];
+	const unsigned char** pointers = new const unsigned char*[FICH_FRAMES];
+
+	for (unsigned int i = 0U; i < FICH_FRAMES; i++) {
+		unsigned char* frame = frames + i * YSF_FRAME_LENGTH_BYTES;
+		for (unsigned int j = 0U; j < YSF_FRAME_LENGTH_BYTES; j++)
+			frame[j] = random() & 0xFFU;
+
+		CYSFFICH fich;
+		fich.setFI(random() & 0x03U);
+		fich.setFN(random() & 0x07U);
+		fich.setFT(random() & 0x07U);
+		fich.encode(frame);
+
+		// A few errors in the FICH, some frames more than the code can correct
+		unsigned int errors = random() % 8U;
+		for (unsigned int j = 0U; j < errors; j++)
+			frame[YSF_SYNC_LENGTH_BYTES + (random() % YSF_FICH_LENGTH_BYTES)] ^= 1U << (random() % 8U);
+
+		pointers[i] = frame;
+	}
+
+	CYSFFICH* fichs = new CYSFFICH[FICH_FRAMES];
+	bool* valid = new bool[FICH_FRAMES];
+
+	unsigned int count = FICH_FRAMES * FICH_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < FICH_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < FICH_FRAMES; i++) {
+			if (fichs[i].decode(pointers[i]))
+				m_sink += fichs[i].getFN();
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < FICH_ROUNDS; n++) {
+		CYSFFICH::decode(pointers, fichs, valid, FICH_FRAMES);
+		for (unsigned int i = 0U; i < FICH_FRAMES; i++) {
+			if (valid[i])
+				m_sink += fichs[i].getFN();
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("YSF FICH decode", "one at a time", oldMS, "batch", newMS, count);
+
+	delete[] frames;
+	delete[] pointers;
+	delete[] fichs;
+	delete[] valid;
+}
+
+void CBenchmark::hamming()
+{
+	// The three (15,11,3) words of an IMBE frame
+	unsigned int* words = new unsigned int[HAMMING_WORDS];
+	bool* bits = new bool[HAMMING_WORDS * 15U];
+
+	for (unsigned int i = 0U; i < HAMMING_WORDS; i++)
+		words[i] = CHamming::encode15113_1(random() & 0x7FFU) ^ randomErrors(15U, 1U);
+
+	unsigned int count = HAMMING_WORDS * HAMMING_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < HAMMING_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < HAMMING_WORDS; i++) {
+			bool* d = bits + i * 15U;
+			for (unsigned int j = 0U; j < 15U; j++)
+				d[j] = ((words[i] >> (14U - j)) & 0x01U) == 0x01U;
+
+			if (CHamming::decode15113_1(d))
+				m_sink++;
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < HAMMING_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < HAMMING_WORDS; i++) {
+			unsigned int code = words[i];
+			if (CHamming::decode15113_1(code))
+				m_sink++;
+			m_sink += code;
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("Hamming (15,11,3) decode", "bool array", oldMS, "packed word", newMS, count);
+
+	delete[] words;
+	delete[] bits;
+}
+
+void CBenchmark::pattern()
+{
+	// Six 33 byte phases, as used by the DMR 1031 Hz test pattern
+	unsigned char phases[6U][33U];
+	for (unsigned int i = 0U; i < 6U; i++) {
+		for (unsigned int j = 0U; j < 33U; j++)
+			phases[i][j] = random() & 0xFFU;
+	}
+
+	CBERPattern engine(33U, 6U);
+	for (unsigned int i = 0U; i < 6U; i++)
+		engine.add(phases[i]);
+
+	unsigned char* frames = new unsigned char[PATTERN_FRAMES * 33U];
+	for (unsigned int i = 0U; i < PATTERN_FRAMES; i++) {
+		for (unsigned int j = 0U; j < 33U; j++)
+			frames[i * 33U + j] = phases[i % 6U][j] ^ (((random() % 100U) == 0U) ? 0x01U : 0x00U);
+	}
+
+	unsigned int count = PATTERN_FRAMES * PATTERN_ROUNDS;
+
+	// The byte at a time loop compared against the one phase given by the modem
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < PATTERN_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < PATTERN_FRAMES; i++) {
+			const unsigned char* frame = frames + i * 33U;
+			for (unsigned int j = 0U; j < 33U; j++) {
+				unsigned char tmp = frame[j] ^ phases[i % 6U][j];
+				while (tmp) {
+					if (tmp % 2 == 1)
+						m_sink++;
+					tmp /= 2;
+				}
+			}
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < PATTERN_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < PATTERN_FRAMES; i++) {
+			unsigned int phase;
+			m_sink += engine.compare(frames + i * 33U, phase);
+			m_sink += phase;
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("DMR 1031 Hz frame", "byte, 1 phase", oldMS, "64-bit, 6 phases", newMS, count);
+
+	delete[] frames;
+}
+
+void CBenchmark::permutation()
+{
+	unsigned int tableA[24U];
+	unsigned int tableB[24U];
+	dstar_tables(tableA, tableB);
+
+	CBitPermutation permutation;
+	permutation.add(tableA, 24U);
+	permutation.add(tableB, 24U);
+	permutation.compile();
+
+	unsigned char* frames = new unsigned char[PERMUTATION_FRAMES * 9U];
+	for (unsigned int i = 0U; i < PERMUTATION_FRAMES * 9U; i++)
+		frames[i] = random() & 0xFFU;
+
+	unsigned int count = PERMUTATION_FRAMES * PERMUTATION_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < PERMUTATION_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < PERMUTATION_FRAMES; i++) {
+			const unsigned char* frame = frames + i * 9U;
+
+			unsigned int a = 0U;
+			unsigned int b = 0U;
+			unsigned int MASK = 0x800000U;
+			for (unsigned int j = 0U; j < 24U; j++, MASK >>= 1) {
+				if (frame[tableA[j] >> 3] & (0x80U >> (tableA[j] & 7U)))
+					a |= MASK;
+				if (frame[tableB[j] >> 3] & (0x80U >> (tableB[j] & 7U)))
+					b |= MASK;
+			}
+
+			m_sink += a + b;
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < PERMUTATION_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < PERMUTATION_FRAMES; i++) {
+			unsigned int words[2U];
+			permutation.gather(frames + i * 9U, words);
+			m_sink += words[0U] + words[1U];
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("D-Star AMBE extract", "bit by bit", oldMS, "permutation", newMS, count);
+
+	delete[] frames;
+}
+
+void CBenchmark::extract()
+{
+	unsigned int tableA[25U];
+	unsigned int tableB[25U];
+	unsigned int tableC[25U];
+
+	CBitPermutation dstar;
+	dstar_tables(tableA, tableB);
+	dstar.add(tableA, 24U);
+	dstar.add(tableB, 24U);
+	dstar.compile();
+
+	CBitPermutation dmr;
+	CBitPermutation dmrSplit;
+	dmr_tables(tableA, tableB, tableC);
+	dmr.add(tableA, 24U);
+	dmr.add(tableB, 23U);
+	dmr.add(tableC, 25U);
+	dmr.compile();
+	dmrSplit.add(tableA, 24U, 0U, 36U, 48U);
+	dmrSplit.add(tableB, 23U, 0U, 36U, 48U);
+	dmrSplit.add(tableC, 25U, 0U, 36U, 48U);
+	dmrSplit.compile();
+
+	extract("D-Star AMBE gather", dstar);
+	extract("DMR AMBE gather", dmr);
+	extract("DMR split AMBE gather", dmrSplit);
+}
+
+void CBenchmark::extract(const char* name, const CBitPermutation& permutation)
+{
+	assert(name != NULL);
+
+	if (!permutation.hasExtract()) {
+		::fprintf(stdout, "%-28s PEXT not supported by this CPU, or turned off" EOL, name);
+		return;
+	}
+
+	unsigned int length = permutation.getInputBytes();
+
+	unsigned char* frames = new unsigned char[PERMUTATION_FRAMES * length];
+	for (unsigned int i = 0U; i < PERMUTATION_FRAMES * length; i++)
+		frames[i] = random() & 0xFFU;
+
+	unsigned int count = PERMUTATION_FRAMES * PERMUTATION_ROUNDS;
+	unsigned int words[BIT_PERMUTATION_MAX_WORDS];
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < PERMUTATION_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < PERMUTATION_FRAMES; i++) {
+			permutation.gatherTable(frames + i * length, words);
+			m_sink += words[0U] + words[1U];
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < PERMUTATION_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < PERMUTATION_FRAMES; i++) {
+			permutation.gatherExtract(frames + i * length, words);
+			m_sink += words[0U] + words[1U];
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report(name, "table", oldMS, "PEXT", newMS, count);
+
+	delete[] frames;
+}
+
+void CBenchmark::imbe()
+{
+	CBERCal cal;
+
+	unsigned char errors[18U];
+
+	// Random frames are made valid by taking out the errors that the decoder
+	// finds, then given up to two bit errors each, as a test pattern would be
+	unsigned char* frames = new unsigned char[IMBE_FRAMES * 18U];
+	for (unsigned int i = 0U; i < IMBE_FRAMES; i++) {
+		unsigned char* frame = frames + i * 18U;
+		for (unsigned int j = 0U; j < 18U; j++)
+			frame[j] = random() & 0xFFU;
+
+		cal.regenerateIMBE(frame, errors);
+		for (unsigned int j = 0U; j < 18U; j++)
+			frame[j] ^= errors[j];
+
+		unsigned int n = random() % 3U;
+		for (unsigned int j = 0U; j < n; j++)
+			frame[random() % 18U] ^= 1U << (random() % 8U);
+	}
+	unsigned int count = IMBE_FRAMES * IMBE_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < IMBE_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < IMBE_FRAMES; i++)
+			m_sink += cal.regenerateIMBEReference(frames + i * 18U);
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < IMBE_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < IMBE_FRAMES; i++)
+			m_sink += cal.regenerateIMBE(frames + i * 18U, errors) + errors[i % 18U];
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("P25 IMBE regenerate", "bool array", oldMS, "packed", newMS, count);
+
+	delete[] frames;
+}
+
+void CBenchmark::ldu()
+{
+	unsigned char* frames = new unsigned char[LDU_FRAMES * LDU_LENGTH];
+	for (unsigned int i = 0U; i < LDU_FRAMES * LDU_LENGTH; i++)
+		frames[i] = random() & 0xFFU;
+
+	unsigned char nid[P25_NID_LENGTH_BYTES];
+	unsigned char imbe[P25_LDU_IMBE_FRAMES * P25_IMBE_LENGTH_BYTES];
+	// Only the IMBE bits are written, the rest are read into the checksum
+	unsigned char map[LDU_LENGTH];
+	::memset(map, 0x00U, LDU_LENGTH);
+
+	unsigned int count = LDU_FRAMES * LDU_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < LDU_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < LDU_FRAMES; i++) {
+			const unsigned char* frame = frames + i * LDU_LENGTH;
+
+			p25_decode_bits(frame, nid, 48U, 114U);
+			for (unsigned int j = 0U; j < P25_LDU_IMBE_FRAMES; j++)
+				p25_decode_bits(frame, imbe + j * P25_IMBE_LENGTH_BYTES, LDU_IMBE_START[j], LDU_IMBE_STOP[j]);
+
+			m_sink += nid[1U] + imbe[i % sizeof(imbe)];
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < LDU_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < LDU_FRAMES; i++) {
+			CP25Utils::decodeLDU(frames + i * LDU_LENGTH, nid, imbe);
+
+			m_sink += nid[1U] + imbe[i % sizeof(imbe)];
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("P25 LDU extract", "bit by bit", oldMS, "one pass", newMS, count);
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < LDU_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < LDU_FRAMES; i++) {
+			const unsigned char* errors = frames + i * LDU_LENGTH;
+
+			for (unsigned int j = 0U; j < P25_LDU_IMBE_FRAMES; j++)
+				p25_encode_bits(errors + j * P25_IMBE_LENGTH_BYTES, map, LDU_IMBE_START[j], LDU_IMBE_STOP[j]);
+
+			m_sink += map[i % LDU_LENGTH];
+		}
+	}
+	oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < LDU_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < LDU_FRAMES; i++) {
+			CP25Utils::encodeLDU(frames + i * LDU_LENGTH, map);
+
+			m_sink += map[i % LDU_LENGTH];
+		}
+	}
+	newMS = m_stopWatch.elapsed();
+
+	report("P25 LDU error map", "bit by bit", oldMS, "one pass", newMS, count);
+
+	delete[] frames;
+}
+
+// The YSF V/D mode 2 VCH errors, as each of the 81 repeated bits used to be
+// read, un-whitened and voted on a triplet at a time
+void CBenchmark::vch()
+{
+	CBERCal cal;
+
+	unsigned char* frames = new unsigned char[VCH_FRAMES * YSF_FRAME_LENGTH_BYTES];
+	for (unsigned int i = 0U; i < VCH_FRAMES * YSF_FRAME_LENGTH_BYTES; i++)
+		frames[i] = random() & 0xFFU;
+
+	// The values don't change the timing
+	unsigned char whitening[11U];
+	for (unsigned int i = 0U; i < 11U; i++)
+		whitening[i] = random() & 0xFFU;
+
+	unsigned char map[YSF_FRAME_LENGTH_BYTES];
+
+	unsigned int count = VCH_FRAMES * VCH_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < VCH_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < VCH_FRAMES; i++) {
+			const unsigned char* frame = frames + i * YSF_FRAME_LENGTH_BYTES + YSF_SYNC_LENGTH_BYTES + YSF_FICH_LENGTH_BYTES;
+
+			::memset(map, 0x00U, YSF_FRAME_LENGTH_BYTES);
+
+			unsigned int errors = 0U;
+			for (unsigned int offset = 40U; offset < 760U; offset += 144U) {
+				bool bits[81U];
+				for (unsigned int j = 0U; j < 81U; j++)
+					bits[j] = CBitUtils::readBit(frame, offset + (j % 26U) * 4U + j / 26U) != CBitUtils::readBit(whitening, j);
+
+				for (unsigned int j = 0U; j < 81U; j += 3U) {
+					unsigned int vote = (bits[j] ? 1U : 0U) + (bits[j + 1U] ? 1U : 0U) + (bits[j + 2U] ? 1U : 0U);
+					if (vote == 0U || vote == 3U)
+						continue;
+
+					for (unsigned int k = j; k < (j + 3U); k++) {
+						if (bits[k] != (vote == 2U))
+							CBitUtils::setBit(map, (YSF_SYNC_LENGTH_BYTES + YSF_FICH_LENGTH_BYTES) * 8U + offset + (k % 26U) * 4U + k / 26U);
+					}
+
+					errors++;
+				}
+			}
+
+			m_sink += errors + map[i % YSF_FRAME_LENGTH_BYTES];
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < VCH_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < VCH_FRAMES; i++) {
+			::memset(map, 0x00U, YSF_FRAME_LENGTH_BYTES);
+
+			m_sink += cal.decodeVoice(CBERYSF(), frames + i * YSF_FRAME_LENGTH_BYTES, 0U, map) + map[i % YSF_FRAME_LENGTH_BYTES];
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("YSF VCH vote", "bit by bit", oldMS, "3 words", newMS, count);
+
+	delete[] frames;
+}
+
+// Synthesising YSF frames, the convolutional code on its own and the whole FICH
+void CBenchmark::encode()
+{
+	CYSFConvolution convolution;
+
+	unsigned char* data = new unsigned char[ENCODE_FRAMES * 13U];
+	for (unsigned int i = 0U; i < ENCODE_FRAMES * 13U; i++)
+		data[i] = (i % 13U) == 12U ? 0x00U : (random() & 0xFFU);
+
+	unsigned char convolved[25U];
+	unsigned int count = ENCODE_FRAMES * ENCODE_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < ENCODE_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < ENCODE_FRAMES; i++) {
+			convolution.encodeSerial(data + i * 13U, convolved, 100U);
+			m_sink += convolved[i % 25U];
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < ENCODE_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < ENCODE_FRAMES; i++) {
+			convolution.encode(data + i * 13U, convolved, 100U);
+			m_sink += convolved[i % 25U];
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("YSF convolution encode", "bit by bit", oldMS, "byte table", newMS, count);
+
+	CYSFFICH* fichs = new CYSFFICH[ENCODE_FRAMES];
+	for (unsigned int i = 0U; i < ENCODE_FRAMES; i++) {
+		fichs[i].setFI(random() & 0x03U);
+		fichs[i].setFN(random() & 0x07U);
+		fichs[i].setFT(random() & 0x07U);
+		fichs[i].setSQ(random() & 0x7FU);
+	}
+
+	unsigned char frame[YSF_FRAME_LENGTH_BYTES];
+	::memset(frame, 0x00U, YSF_FRAME_LENGTH_BYTES);
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < ENCODE_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < ENCODE_FRAMES; i++) {
+			fichs[i].encodeSerial(frame);
+			m_sink += frame[YSF_SYNC_LENGTH_BYTES + i % YSF_FICH_LENGTH_BYTES];
+		}
+	}
+	oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < ENCODE_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < ENCODE_FRAMES; i++) {
+			fichs[i].encode(frame);
+			m_sink += frame[YSF_SYNC_LENGTH_BYTES + i % YSF_FICH_LENGTH_BYTES];
+		}
+	}
+	newMS = m_stopWatch.elapsed();
+
+	report("YSF FICH encode", "bit by bit", oldMS, "words", newMS, count);
+
+	delete[] data;
+	delete[] fichs;
+}
+
+void CBenchmark::crc()
+{
+	unsigned char* buffer = new unsigned char[CRC_BUFFER_LENGTH];
+	for (unsigned int i = 0U; i < CRC_BUFFER_LENGTH; i++)
+		buffer[i] = random() & 0xFFU;
+
+	unsigned int count = CRC_BUFFER_LENGTH * CRC_BUFFER_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < CRC_BUFFER_ROUNDS; n++)
+		m_sink += CBenchmarkCRC::computeBytes(buffer, CRC_BUFFER_LENGTH - (n & 0x01U));
+	rate("CRC-CCITT 4 KB byte table", m_stopWatch.elapsed(), count, "bytes");
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < CRC_BUFFER_ROUNDS; n++)
+		m_sink += CBenchmarkCRC::computeSliced(buffer, CRC_BUFFER_LENGTH - (n & 0x01U));
+	rate("CRC-CCITT 4 KB slicing by 8", m_stopWatch.elapsed(), count, "bytes");
+
+	if (CCRCFold::isSupported()) {
+		m_stopWatch.start();
+		for (unsigned int n = 0U; n < CRC_BUFFER_ROUNDS; n++)
+			m_sink += CBenchmarkCRC::computeFolded(buffer, CRC_BUFFER_LENGTH - (n & 0x01U));
+		rate("CRC-CCITT 4 KB PCLMULQDQ", m_stopWatch.elapsed(), count, "bytes");
+	} else {
+		::fprintf(stdout, "%-28s not supported by this CPU, or turned off" EOL, "CRC-CCITT 4 KB PCLMULQDQ");
+	}
+
+	delete[] buffer;
+
+	// D-Star headers from a capture, most of them good
+	unsigned char* headers = new unsigned char[CRC_HEADERS * CRC_HEADER_LENGTH];
+	const unsigned char** pointers = new const unsigned char*[CRC_HEADERS];
+
+	for (unsigned int i = 0U; i < CRC_HEADERS; i++) {
+		unsigned char* header = headers + i * CRC_HEADER_LENGTH;
+		for (unsigned int j = 0U; j < CRC_HEADER_LENGTH; j++)
+			header[j] = random() & 0xFFU;
+
+		CCRC::addCCITT161(header, CRC_HEADER_LENGTH);
+
+		if ((random() % 8U) == 0U)
+			header[random() % CRC_HEADER_LENGTH] ^= 1U << (random() % 8U);
+
+		pointers[i] = header;
+	}
+
+	bool* valid = new bool[CRC_HEADERS];
+
+	count = CRC_HEADERS * CRC_HEADER_ROUNDS;
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < CRC_HEADER_ROUNDS; n++) {
+		for (unsigned int i = 0U; i < CRC_HEADERS; i++) {
+			if (CCRC::checkCCITT161(pointers[i], CRC_HEADER_LENGTH))
+				m_sink++;
+		}
+	}
+	unsigned int oldMS = m_stopWatch.elapsed();
+
+	m_stopWatch.start();
+	for (unsigned int n = 0U; n < CRC_HEADER_ROUNDS; n++) {
+		CCRC::checkCCITT161(pointers, CRC_HEADER_LENGTH, valid, CRC_HEADERS);
+		for (unsigned int i = 0U; i < CRC_HEADERS; i++) {
+			if (valid[i])
+				m_sink++;
+		}
+	}
+	unsigned int newMS = m_stopWatch.elapsed();
+
+	report("D-Star header CRC check", "one at a time", oldMS, "batch", newMS, count);
+
+	delete[] headers;
+	delete[] pointers;
+	delete[] valid;
+}
+
+void CBenchmark::allocations()
+{
+	if (!CAllocationCounter::isCounting()) {
+		::fprintf(stdout, "%-28s not counted, build with \"make COUNT_ALLOCS=1\"" EOL, "Decode allocations");
+		return;
+	}
+
+	CBERCal cal;
+
+	unsigned char* frames = new unsigned char[ALLOCATION_FRAMES * ALLOCATION_LENGTH];
+	for (unsigned int i = 0U; i < ALLOCATION_FRAMES * ALLOCATION_LENGTH; i++)
+		frames[i] = random() & 0xFFU;
+
+	// The first pass builds any tables that are made on first use
+	unsigned long long counts[5U];
+	for (unsigned int n = 0U; n < 2U; n++) {
+		for (unsigned int mode = 0U; mode < 5U; mode++) {
+			unsigned long long start = CAllocationCounter::get();
+
+			for (unsigned int i = 0U; i < ALLOCATION_FRAMES; i++)
+				decodeFrame(cal, mode, frames + i * ALLOCATION_LENGTH);
+
+			counts[mode] = CAllocationCounter::get() - start;
+		}
+	}
+
+	::fprintf(stdout, "%-28s D-Star: %llu, DMR: %llu, YSF: %llu, P25: %llu, NXDN: %llu in %u frames each" EOL, "Decode allocations",
+		counts[0U], counts[1U], counts[2U], counts[3U], counts[4U], ALLOCATION_FRAMES);
+
+	delete[] frames;
+}
+
+// The memory taken by the tables in this build, "make SMALL=1" for the small
+// one, and how long a frame of each mode takes to decode with them
+void CBenchmark::footprint()
+{
+	CBERCal cal;
+
+	unsigned char* frames = new unsigned char[ALLOCATION_FRAMES * ALLOCATION_LENGTH];
+	for (unsigned int i = 0U; i < ALLOCATION_FRAMES * ALLOCATION_LENGTH; i++)
+		frames[i] = random() & 0xFFU;
+
+	// Builds any tables that are made on first use
+	for (unsigned int mode = 0U; mode < 5U; mode++)
+		decodeFrame(cal, mode, frames);
+
+	double ns[5U];
+	for (unsigned int mode = 0U; mode < 5U; mode++) {
+		m_stopWatch.start();
+		for (unsigned int n = 0U; n < FOOTPRINT_ROUNDS; n++) {
+			for (unsigned int i = 0U; i < ALLOCATION_FRAMES; i++)
+				decodeFrame(cal, mode, frames + i * ALLOCATION_LENGTH);
+		}
+		ns[mode] = double(m_stopWatch.elapsed()) * 1000000.0 / double(ALLOCATION_FRAMES * FOOTPRINT_ROUNDS);
+	}
+
+#if defined(SMALL_TABLES)
+	const char* profile = "small";
+#else
+	const char* profile = "full";
+#endif
+
+	unsigned int golay = CGolay24128::getTableBytes();
+	unsigned int crc   = CCRC::getTableBytes();
+	unsigned int ber   = cal.getTableBytes();
+
+	::fprintf(stdout, "%-28s %s, Golay: %.1f KB, CRC: %.1f KB, BER: %.1f KB, total: %.1f KB" EOL, "Table footprint", profile,
+		double(golay) / 1024.0, double(crc) / 1024.0, double(ber) / 1024.0, double(golay + crc + ber) / 1024.0);
+	::fprintf(stdout, "%-28s D-Star: %.1f ns, DMR: %.1f ns, YSF: %.1f ns, P25: %.1f ns, NXDN: %.1f ns" EOL, "Frame decode",
+		ns[0U], ns[1U], ns[2U], ns[3U], ns[4U]);
+
+	delete[] frames;
+}
+
+// The per frame work of each mode, as CBERCal does it for a received frame,
+// without the calls that print. Random YSF frames fail the FICH CRC and the
+// NXDN frames are given no tag, so those two go through the real entry points.
+void CBenchmark::decodeFrame(CBERCal& cal, unsigned int mode, const unsigned char* frame)
+{
+	assert(frame != NULL);
+
+	unsigned char map[CBERP25::FRAME_BYTES];
+	::memset(map, 0x00U, CBERP25::FRAME_BYTES);
+
+	switch (mode) {
+	case 0U:
+		m_sink += cal.decodeVoice(CBERDStar(), frame, 0x11U, map);
+		m_sink += cal.DSTARPolarity(frame);
+		break;
+	case 1U:
+		m_sink += cal.decodeVoice(CBERDMR(), frame, 0U, map);
+		m_sink += cal.DMRPolarity(frame);
+		break;
+	case 2U:
+		cal.YSFFEC(frame);
+		m_sink += cal.YSFPolarity(frame);
+		break;
+	case 3U:
+		m_sink += cal.decodeVoice(CBERP25(), frame, 0x05U, map);
+		m_sink += cal.P25Polarity(frame);
+		break;
+	default:
+		cal.NXDNFEC(frame, 0U);
+		m_sink += cal.NXDNPolarity(frame);
+		break;
+	}
+
+	m_sink += map[0U];
+}
+
+unsigned int CBenchmark::random()
+{
+	// xorshift32, repeatable between runs
+	m_random ^= m_random << 13;
+	m_random ^= m_random >> 17;
+	m_random ^= m_random << 5;
+
+	return m_random;
+}
+
+unsigned int CBenchmark::randomErrors(unsigned int bits, unsigned int max)
+{
+	assert(bits <= 32U);
+
+	unsigned int errors = 0U;
+
+	unsigned int n = random() % (max + 1U);
+	for (unsigned int i = 0U; i < n; i++)
+		errors |= 1U << (random() % bits);
+
+	return errors;
+}
+
+void CBenchmark::report(const char* name, const char* oldName, unsigned int oldMS, const char* newName, unsigned int newMS, unsigned int count)
+{
+	assert(name != NULL);
+	assert(oldName != NULL);
+	assert(newName != NULL);
+
+	if (oldMS == 0U)
+		oldMS = 1U;
+	if (newMS == 0U)
+		newMS = 1U;
+
+	::fprintf(stdout, "%-28s %s: %.1f ns, %s: %.1f ns, speedup: %.2fx" EOL, name,
+		oldName, double(oldMS) * 1000000.0 / double(count),
+		newName, double(newMS) * 1000000.0 / double(count),
+		double(oldMS) / double(newMS));
+}
+
+void CBenchmark::rate(const char* name, unsigned int ms, unsigned int count, const char* units)
+{
+	assert(name != NULL);
+	assert(units != NULL);
+
+	if (ms == 0U)
+		ms = 1U;
+
+	::fprintf(stdout, "%-28s %.1f ns, %.1f M %s/s per core" EOL, name, double(ms) * 1000000.0 / double(count), double(count) / (double(ms) * 1000.0), units);
+}
@@ -0,0 +1,63 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BENCHMARK_H)
+#define	BENCHMARK_H
+
+#include "BERCal.h"
+#include "BitPermutation.h"
+#include "StopWatch.h"
+
+class CBenchmark {
+public:
+	CBenchmark();
+	~CBenchmark();
+
+	int run();
+
+private:
+	CStopWatch   m_stopWatch;
+	unsigned int m_random;
+	unsigned int m_sink;
+
+	void golay();
+	void syndrome();
+	void golayBatch();
+	void fich();
+	void hamming();
+	void pattern();
+	void permutation();
+	void extract();
+	void extract(const char* name, const CBitPermutation& permutation);
+	void imbe();
+	void ldu();
+	void vch();
+	void encode();
+	void crc();
+	void allocations();
+	void footprint();
+	void decodeFrame(CBERCal& cal, unsigned int mode, const unsigned char* frame);
+
+	unsigned int random();
+	unsigned int randomErrors(unsigned int bits, unsigned int max);
+
+	void report(const char* name, const char* oldName, unsigned int oldMS, const char* newName, unsigned int newMS, unsigned int count);
+	void rate(const char* name, unsigned int ms, unsigned int count, const char* units);
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+// Only extract() is built for BMI2, CBitPermutation only calls it if the CPU has it
+#if defined(__GNUC__) && defined(__x86_64__)
+#define	BIT_EXTRACT_PEXT
+#endif
+
+#include "BitExtract.h"
+#include "CPUDispatch.h"
+#include "BitUtils.h"
+
+#include <cassert>
+
+#if defined(BIT_EXTRACT_PEXT)
+
+#include <immintrin.h>
+
+bool CBitExtract::isSupported()
+{
+	return CCPUDispatch::has(CPU_BMI2) && CCPUDispatch::hasFastPEXT();
+}
+
+// The bytes are swapped so that the first bit of the frame is the top bit of
+// the load, PEXT then keeps the first bit of each segment as its top bit.
+__attribute__((target("bmi2")))
+void CBitExtract::extract(const unsigned char* in, const CBitSegment* segments, unsigned int count, const unsigned int* init, unsigned int* out, unsigned int words)
+{
+	assert(in != NULL);
+	assert(segments != NULL);
+	assert(init != NULL);
+	assert(out != NULL);
+
+	for (unsigned int w = 0U; w < words; w++)
+		out[w] = init[w];
+
+	// The segments are in word order, so each word is built up in a register,
+	// and as every segment has its own shift they do not wait on each other
+	uint64_t word = 0U;
+	for (unsigned int i = 0U; i < count; i++) {
+		const CBitSegment& s = segments[i];
+
+		uint64_t value = CBitUtils::load64(in + s.m_byte);
+
+		word |= _pext_u64(value, s.m_mask) << s.m_shift;
+
+		if ((i + 1U) == count || segments[i + 1U].m_word != s.m_word) {
+			out[s.m_word] ^= (unsigned int)word;
+			word = 0U;
+		}
+	}
+}
+
+#else
+
+bool CBitExtract::isSupported()
+{
+	return false;
+}
+
+void CBitExtract::extract(const unsigned char* in, const CBitSegment* segments, unsigned int count, const unsigned int* init, unsigned int* out, unsigned int words)
+{
+	// Never called, isSupported() returns false
+	assert(false);
+}
+
+#endif
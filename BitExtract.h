@@ -0,0 +1,44 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BITEXTRACT_H)
+#define	BITEXTRACT_H
+
+#include <cstdint>
+
+// A run of rising bit positions that all fall in the eight bytes from m_byte,
+// whose bits go into word m_word in order, the last one m_shift bits up.
+struct CBitSegment {
+	unsigned int m_byte;
+	unsigned int m_shift;
+	unsigned int m_word;
+	uint64_t     m_mask;
+};
+
+// Pulls the segments out of a frame with PEXT, each one being a single 64 bit
+// load and extract. CBitPermutation builds the segments and only calls this
+// when isSupported() is true.
+class CBitExtract {
+public:
+	static bool isSupported();
+
+	// The segments must be in word order, the words start from init
+	static void extract(const unsigned char* in, const CBitSegment* segments, unsigned int count, const unsigned int* init, unsigned int* out, unsigned int words);
+};
+
+#endif
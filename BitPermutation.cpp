@@ -0,0 +1,340 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "BitPermutation.h"
+#include "BitUtils.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+
+// Byte tables are used if they fit in this many bytes, otherwise half bytes,
+// which are a sixteenth of the size
+#if defined(SMALL_TABLES)
+const unsigned int BYTE_TABLE_BUDGET = 4096U;
+#else
+const unsigned int BYTE_TABLE_BUDGET = 16384U;
+#endif
+
+// The rows are a fixed length so that the words stay in registers
+template <unsigned int STRIDE, typename L>
+static inline void gather_rows(const L* lookups, unsigned int count, const unsigned int* init, const unsigned char* in, unsigned int* out, unsigned int words)
+{
+	unsigned int acc[STRIDE];
+	for (unsigned int w = 0U; w < STRIDE; w++)
+		acc[w] = init[w];
+
+	for (unsigned int n = 0U; n < count; n++) {
+		const L& l = lookups[n];
+		const unsigned int* row = l.m_table + ((in[l.m_byte] >> l.m_shift) & l.m_mask) * STRIDE;
+
+		for (unsigned int w = 0U; w < STRIDE; w++)
+			acc[w] ^= row[w];
+	}
+
+	for (unsigned int w = 0U; w < words; w++)
+		out[w] = acc[w];
+}
+
+CBitPermutation::CBitPermutation() :
+m_words(0U),
+m_bits(0U),
+m_inputBytes(0U),
+m_stride(0U),
+m_lookups(NULL),
+m_nLookups(0U),
+m_table(NULL),
+m_segments(NULL),
+m_nSegments(0U),
+m_extract(false),
+m_compiled(false)
+{
+}
+
+CBitPermutation::~CBitPermutation()
+{
+	delete[] m_lookups;
+	delete[] m_table;
+	delete[] m_segments;
+}
+
+void CBitPermutation::add(const unsigned int* table, unsigned int length, unsigned int offset, unsigned int gapPos, unsigned int gapLength)
+{
+	assert(table != NULL);
+	assert(length > 0U && length <= BIT_PERMUTATION_MAX_WORD_BITS);
+	assert(m_words < BIT_PERMUTATION_MAX_WORDS);
+	assert(!m_compiled);
+
+	for (unsigned int i = 0U; i < length; i++) {
+		unsigned int pos = table[i] + offset;
+		if (pos >= gapPos)
+			pos += gapLength;
+
+		m_positions[m_bits++] = pos;
+	}
+
+	m_lengths[m_words++] = length;
+}
+
+void CBitPermutation::add(unsigned int start, unsigned int step, unsigned int length)
+{
+	assert(length > 0U && length <= BIT_PERMUTATION_MAX_WORD_BITS);
+	assert(m_words < BIT_PERMUTATION_MAX_WORDS);
+	assert(!m_compiled);
+
+	for (unsigned int i = 0U; i < length; i++)
+		m_positions[m_bits++] = start + i * step;
+
+	m_lengths[m_words++] = length;
+}
+
+void CBitPermutation::compile(const unsigned char* scrambler, const unsigned char* whitening)
+{
+	assert(!m_compiled);
+	assert(m_words > 0U);
+
+	m_stride = ((m_words + 3U) / 4U) * 4U;
+
+	m_inputBytes = 0U;
+	for (unsigned int i = 0U; i < m_bits; i++) {
+		if ((m_positions[i] / 8U) >= m_inputBytes)
+			m_inputBytes = m_positions[i] / 8U + 1U;
+	}
+
+	unsigned int size = countChunks(8U) * 256U * m_stride * sizeof(unsigned int);
+
+	build(size <= BYTE_TABLE_BUDGET ? 8U : 4U);
+	buildXor(scrambler, whitening, m_xor);
+
+	// A 64 bit load must fit in the frame
+	if (m_inputBytes >= 8U && CBitExtract::isSupported()) {
+		buildSegments();
+		m_extract = m_nSegments <= m_nLookups;
+	}
+
+	m_compiled = true;
+}
+
+// The number of chunks of the frame with at least one bit used
+unsigned int CBitPermutation::countChunks(unsigned int chunkBits) const
+{
+	unsigned int count = 0U;
+
+	for (unsigned int chunk = 0U; chunk < (m_inputBytes * 8U / chunkBits); chunk++) {
+		for (unsigned int i = 0U; i < m_bits; i++) {
+			if ((m_positions[i] / chunkBits) == chunk) {
+				count++;
+				break;
+			}
+		}
+	}
+
+	return count;
+}
+
+void CBitPermutation::build(unsigned int chunkBits)
+{
+	unsigned int values = 1U << chunkBits;
+
+	m_nLookups = countChunks(chunkBits);
+	m_lookups  = new CLookup[m_nLookups];
+	m_table    = new unsigned int[m_nLookups * values * m_stride];
+	::memset(m_table, 0x00U, m_nLookups * values * m_stride * sizeof(unsigned int));
+
+	unsigned int n = 0U;
+	for (unsigned int chunk = 0U; chunk < (m_inputBytes * 8U / chunkBits); chunk++) {
+		// The rest of the frame has no bits used, such as the last half byte
+		if (n == m_nLookups)
+			break;
+
+		unsigned int first = chunk * chunkBits;
+
+		CLookup& l = m_lookups[n];
+		l.m_byte  = first / 8U;
+		l.m_shift = 8U - chunkBits - first % 8U;
+		l.m_mask  = values - 1U;
+		l.m_table = m_table + n * values * m_stride;
+
+		bool used = false;
+
+		unsigned int bit = 0U;
+		for (unsigned int w = 0U; w < m_words; w++) {
+			for (unsigned int i = 0U; i < m_lengths[w]; i++, bit++) {
+				unsigned int pos = m_positions[bit];
+				if (pos < first || pos >= (first + chunkBits))
+					continue;
+
+				unsigned int in  = 1U << (chunkBits - 1U - (pos - first));
+				unsigned int out = 1U << (m_lengths[w] - 1U - i);
+
+				for (unsigned int v = 0U; v < values; v++) {
+					if ((v & in) == in)
+						l.m_table[v * m_stride + w] |= out;
+				}
+
+				used = true;
+			}
+		}
+
+		if (used)
+			n++;
+	}
+
+	assert(n == m_nLookups);
+}
+
+// What the scrambler and whitening add to each word
+void CBitPermutation::buildXor(const unsigned char* scrambler, const unsigned char* whitening, unsigned int* init) const
+{
+	assert(init != NULL);
+
+	for (unsigned int w = 0U; w < BIT_PERMUTATION_MAX_WORDS; w++)
+		init[w] = 0U;
+
+	unsigned int bit = 0U;
+	for (unsigned int w = 0U; w < m_words; w++) {
+		for (unsigned int i = 0U; i < m_lengths[w]; i++, bit++) {
+			unsigned int out = 1U << (m_lengths[w] - 1U - i);
+			unsigned int pos = m_positions[bit];
+
+			if (scrambler != NULL && CBitUtils::readBit(scrambler, pos))
+				init[w] ^= out;
+			if (whitening != NULL && CBitUtils::readBit(whitening, bit))
+				init[w] ^= out;
+		}
+	}
+}
+
+// Each run of rising positions is cut where it would leave the eight bytes
+// from its first byte, or the end of the frame for runs near the end.
+void CBitPermutation::buildSegments()
+{
+	m_segments  = new CBitSegment[m_bits];
+	m_nSegments = 0U;
+
+	unsigned int bit = 0U;
+	for (unsigned int w = 0U; w < m_words; w++) {
+		CBitSegment* s = NULL;
+		unsigned int last = 0U;
+
+		for (unsigned int i = 0U; i < m_lengths[w]; i++, bit++) {
+			unsigned int pos = m_positions[bit];
+
+			if (s == NULL || pos <= last || pos >= (s->m_byte * 8U + 64U)) {
+				s = m_segments + m_nSegments++;
+				s->m_byte = pos / 8U;
+				if (s->m_byte > (m_inputBytes - 8U))
+					s->m_byte = m_inputBytes - 8U;
+				s->m_shift = 0U;
+				s->m_word = w;
+				s->m_mask = 0U;
+			}
+
+			s->m_mask |= uint64_t(1U) << (63U - (pos - s->m_byte * 8U));
+			s->m_shift = m_lengths[w] - 1U - i;
+			last = pos;
+		}
+	}
+}
+
+void CBitPermutation::gather(const unsigned char* in, unsigned int* out) const
+{
+	gather(in, m_xor, out);
+}
+
+void CBitPermutation::getXor(const unsigned char* scrambler, unsigned int* init) const
+{
+	assert(m_compiled);
+
+	buildXor(scrambler, NULL, init);
+}
+
+void CBitPermutation::gather(const unsigned char* in, const unsigned int* init, unsigned int* out) const
+{
+	if (m_extract)
+		gatherExtract(in, init, out);
+	else
+		gatherTable(in, init, out);
+}
+
+void CBitPermutation::gatherExtract(const unsigned char* in, unsigned int* out) const
+{
+	gatherExtract(in, m_xor, out);
+}
+
+void CBitPermutation::gatherExtract(const unsigned char* in, const unsigned int* init, unsigned int* out) const
+{
+	assert(in != NULL);
+	assert(init != NULL);
+	assert(out != NULL);
+	assert(m_compiled);
+	assert(m_segments != NULL);
+
+	CBitExtract::extract(in, m_segments, m_nSegments, init, out, m_words);
+}
+
+void CBitPermutation::gatherTable(const unsigned char* in, unsigned int* out) const
+{
+	gatherTable(in, m_xor, out);
+}
+
+void CBitPermutation::gatherTable(const unsigned char* in, const unsigned int* init, unsigned int* out) const
+{
+	assert(in != NULL);
+	assert(init != NULL);
+	assert(out != NULL);
+	assert(m_compiled);
+
+	switch (m_stride) {
+	case 4U:
+		gather_rows<4U>(m_lookups, m_nLookups, init, in, out, m_words);
+		break;
+	case 8U:
+		gather_rows<8U>(m_lookups, m_nLookups, init, in, out, m_words);
+		break;
+	default:
+		gather_rows<12U>(m_lookups, m_nLookups, init, in, out, m_words);
+		break;
+	}
+}
+
+bool CBitPermutation::hasExtract() const
+{
+	return m_segments != NULL;
+}
+
+unsigned int CBitPermutation::getWords() const
+{
+	return m_words;
+}
+
+unsigned int CBitPermutation::getInputBytes() const
+{
+	return m_inputBytes;
+}
+
+unsigned int CBitPermutation::getTableBytes() const
+{
+	unsigned int values = m_nLookups > 0U ? (m_lookups[0U].m_mask + 1U) : 0U;
+
+	unsigned int bytes = m_nLookups * (sizeof(CLookup) + values * m_stride * sizeof(unsigned int));
+	if (m_segments != NULL)
+		bytes += m_bits * sizeof(CBitSegment);
+
+	return bytes;
+}
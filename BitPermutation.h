@@ -0,0 +1,115 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BITPERMUTATION_H)
+#define	BITPERMUTATION_H
+
+#include "BitExtract.h"
+
+#include <cstddef>
+
+const unsigned int BIT_PERMUTATION_MAX_WORDS     = 12U;
+const unsigned int BIT_PERMUTATION_MAX_WORD_BITS = 32U;
+
+// Gathers scattered bits from a frame into packed words, such as the AMBE
+// code words of a D-Star or DMR frame. Each call to add() makes one word of
+// up to 32 bits, with the first bit position in the table going to its most
+// significant bit, and positions counted from the MSB of the first byte.
+//
+// compile() turns the tables into a lookup table for every byte, or half
+// byte for the larger ones, that holds bits used. Each value looks up a row
+// with the bits it gives to every word, so a gather is one lookup and a few
+// XORs per chunk. Up to twelve words may be added, but fewer words make
+// shorter rows, so it pays to group them by frame. Any scrambling of the
+// frame or whitening of the words is folded into a constant that the words
+// start from, so the gather and the descramble are done in one pass. Frames
+// with the same layout but their own scrambling can share one permutation,
+// each gathering from its own constant made by getXor().
+//
+// When the CPU has BMI2, each word is also split into runs of rising
+// positions that fit in a 64 bit load, and if there are fewer runs than
+// table lookups gather() uses PEXT on them instead.
+class CBitPermutation {
+public:
+	CBitPermutation();
+	~CBitPermutation();
+
+	// Positions at or after gapPos are moved on by gapLength, as for the sync in a DMR burst
+	void add(const unsigned int* table, unsigned int length, unsigned int offset = 0U, unsigned int gapPos = 0xFFFFFFFFU, unsigned int gapLength = 0U);
+
+	// Positions start, start + step, start + 2 * step, ...
+	void add(unsigned int start, unsigned int step, unsigned int length);
+
+	// The scrambler is over the frame, the whitening over the words, taken as one
+	// run of bits in the order they were added. Either may be NULL.
+	void compile(const unsigned char* scrambler = NULL, const unsigned char* whitening = NULL);
+
+	void gather(const unsigned char* in, unsigned int* out) const;
+
+	// What a scrambler over the frame adds to each word, to gather with in
+	// place of the constant compiled in. Both take BIT_PERMUTATION_MAX_WORDS.
+	void getXor(const unsigned char* scrambler, unsigned int* init) const;
+	void gather(const unsigned char* in, const unsigned int* init, unsigned int* out) const;
+
+	// The two ways of gathering, gatherExtract() may only be used if hasExtract() is true
+	void gatherTable(const unsigned char* in, unsigned int* out) const;
+	void gatherTable(const unsigned char* in, const unsigned int* init, unsigned int* out) const;
+	void gatherExtract(const unsigned char* in, unsigned int* out) const;
+	void gatherExtract(const unsigned char* in, const unsigned int* init, unsigned int* out) const;
+	bool hasExtract() const;
+
+	unsigned int getWords() const;
+	unsigned int getInputBytes() const;
+
+	// The size of the lookup tables and segments
+	unsigned int getTableBytes() const;
+
+private:
+	// One chunk of the frame and a row of the bits that each of its values gives to the words
+	struct CLookup {
+		unsigned int  m_byte;
+		unsigned int  m_shift;
+		unsigned int  m_mask;
+		unsigned int* m_table;
+	};
+
+	CBitPermutation(const CBitPermutation&);
+	CBitPermutation& operator=(const CBitPermutation&);
+
+	unsigned int  m_words;
+	unsigned int  m_bits;
+	unsigned int  m_positions[BIT_PERMUTATION_MAX_WORDS * BIT_PERMUTATION_MAX_WORD_BITS];
+	unsigned int  m_lengths[BIT_PERMUTATION_MAX_WORDS];
+	unsigned int  m_xor[BIT_PERMUTATION_MAX_WORDS];
+	unsigned int  m_inputBytes;
+	unsigned int  m_stride;
+	CLookup*      m_lookups;
+	unsigned int  m_nLookups;
+	unsigned int* m_table;
+	CBitSegment*  m_segments;
+	unsigned int  m_nSegments;
+	bool          m_extract;
+	bool          m_compiled;
+
+	void build(unsigned int chunkBits);
+	void buildXor(const unsigned char* scrambler, const unsigned char* whitening, unsigned int* init) const;
+	unsigned int countChunks(unsigned int chunkBits) const;
+	void buildSegments();
+};
+
+#endif
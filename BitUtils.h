@@ -0,0 +1,215 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(BITUTILS_H)
+#define	BITUTILS_H
+
+#include <cstdint>
+#include <cstring>
+
+// Set when countBits() is the popcount instruction, as this is fixed when it is built
+#if defined(__GNUC__) && (defined(__POPCNT__) || defined(__aarch64__))
+#define	BIT_UTILS_POPCOUNT
+#endif
+
+// Bit access for frames held MSB first, bit 0 being the top bit of the first
+// byte, shared by all of the protocol code. The single bit functions are
+// constexpr where C++11 allows. Runs of up to 57 bits can be read or written
+// at any position, as a right aligned value, and the writes leave the bits
+// around them alone. Bit counts use the popcount instruction when the build
+// targets a CPU that has it, otherwise a few shifts and adds, which are faster
+// than the library call that the compiler would make.
+class CBitUtils {
+public:
+	static constexpr unsigned char mask(unsigned int pos)
+	{
+		return (unsigned char)(0x80U >> (pos & 7U));
+	}
+
+	static constexpr bool readBit(const unsigned char* in, unsigned int pos)
+	{
+		return (in[pos >> 3] & mask(pos)) != 0U;
+	}
+
+	// No branch on the value of the bit
+	static void writeBit(unsigned char* out, unsigned int pos, bool b)
+	{
+		unsigned char m = mask(pos);
+		out[pos >> 3] = (unsigned char)((out[pos >> 3] & ~m) | (-(unsigned int)b & m));
+	}
+
+	static void setBit(unsigned char* out, unsigned int pos)
+	{
+		out[pos >> 3] |= mask(pos);
+	}
+
+	static uint64_t readBits(const unsigned char* in, unsigned int pos, unsigned int length)
+	{
+		unsigned int first = pos >> 3;
+		unsigned int last  = (pos + length - 1U) >> 3;
+
+		uint64_t value = 0U;
+		for (unsigned int i = first; i <= last; i++)
+			value = (value << 8) | in[i];
+
+		return (value >> ((8U - ((pos + length) & 7U)) & 7U)) & fieldMask(length);
+	}
+
+	static void writeBits(unsigned char* out, unsigned int pos, uint64_t value, unsigned int length)
+	{
+		unsigned int first = pos >> 3;
+		unsigned int last  = (pos + length - 1U) >> 3;
+		unsigned int shift = (8U - ((pos + length) & 7U)) & 7U;
+
+		uint64_t m = fieldMask(length) << shift;
+		value = (value << shift) & m;
+
+		for (unsigned int i = last + 1U; i > first; i--, m >>= 8, value >>= 8)
+			out[i - 1U] = (unsigned char)((out[i - 1U] & ~m) | value);
+	}
+
+	static constexpr uint64_t fieldMask(unsigned int length)
+	{
+		return length >= 64U ? ~uint64_t(0U) : (uint64_t(1U) << length) - 1U;
+	}
+
+	static uint64_t load64(const unsigned char* in)
+	{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		uint64_t value;
+		::memcpy(&value, in, sizeof(uint64_t));
+		return __builtin_bswap64(value);
+#else
+		uint64_t value = 0U;
+		for (unsigned int i = 0U; i < 8U; i++)
+			value = (value << 8) | in[i];
+		return value;
+#endif
+	}
+
+	// The first byte in the low bits, as reflected CRCs want them
+	static uint64_t load64LE(const unsigned char* in)
+	{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		uint64_t value;
+		::memcpy(&value, in, sizeof(uint64_t));
+		return value;
+#else
+		uint64_t value = 0U;
+		for (unsigned int i = 0U; i < 8U; i++)
+			value |= uint64_t(in[i]) << (i * 8U);
+		return value;
+#endif
+	}
+
+	static void store64(unsigned char* out, uint64_t value)
+	{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		value = __builtin_bswap64(value);
+		::memcpy(out, &value, sizeof(uint64_t));
+#else
+		for (unsigned int i = 0U; i < 8U; i++)
+			out[i] = (unsigned char)(value >> (56U - i * 8U));
+#endif
+	}
+
+	static unsigned int countBits(uint32_t v)
+	{
+#if defined(BIT_UTILS_POPCOUNT)
+		return __builtin_popcount(v);
+#else
+		v = v - ((v >> 1) & 0x55555555U);
+		v = (v & 0x33333333U) + ((v >> 2) & 0x33333333U);
+		return (((v + (v >> 4)) & 0x0F0F0F0FU) * 0x01010101U) >> 24;
+#endif
+	}
+
+	static unsigned int countBits64(uint64_t v)
+	{
+#if defined(BIT_UTILS_POPCOUNT)
+		return __builtin_popcountll(v);
+#else
+		v = v - ((v >> 1) & 0x5555555555555555ULL);
+		v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+		v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (unsigned int)((v * 0x0101010101010101ULL) >> 56);
+#endif
+	}
+
+	static unsigned int parity(uint32_t v)
+	{
+#if defined(__GNUC__)
+		return __builtin_parity(v);
+#else
+		v ^= v >> 16;
+		v ^= v >> 8;
+		v ^= v >> 4;
+		v ^= v >> 2;
+		v ^= v >> 1;
+		return v & 0x01U;
+#endif
+	}
+
+	// The index of the lowest set bit, v must not be zero
+	static unsigned int lowestBit(uint32_t v)
+	{
+#if defined(__GNUC__)
+		return __builtin_ctz(v);
+#else
+		unsigned int n = 0U;
+		while ((v & 0x01U) == 0x00U) {
+			v >>= 1;
+			n++;
+		}
+		return n;
+#endif
+	}
+
+	// Eight bools to a byte, the first going to the top bit
+	static unsigned char packByte(const bool* bits)
+	{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		// Each bool is a byte of zero or one, the multiply gathers them into the top byte
+		uint64_t value;
+		::memcpy(&value, bits, sizeof(uint64_t));
+		return (unsigned char)((value * 0x8040201008040201ULL) >> 56);
+#else
+		unsigned char byte = 0U;
+		for (unsigned int i = 0U; i < 8U; i++)
+			byte = (unsigned char)((byte << 1) | (bits[i] ? 0x01U : 0x00U));
+		return byte;
+#endif
+	}
+
+	static void pack(const bool* bits, unsigned char* out, unsigned int length)
+	{
+		unsigned int i = 0U;
+		for (; (i + 8U) <= length; i += 8U)
+			out[i >> 3] = packByte(bits + i);
+		for (; i < length; i++)
+			writeBit(out, i, bits[i]);
+	}
+
+	static void unpack(const unsigned char* in, bool* bits, unsigned int length)
+	{
+		for (unsigned int i = 0U; i < length; i++)
+			bits[i] = readBit(in, i);
+	}
+};
+
+#endif
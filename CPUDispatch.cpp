@@ -0,0 +1,226 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "CPUDispatch.h"
+#include "GolayBatch.h"
+#include "BitExtract.h"
+#include "BitUtils.h"
+#include "CRCFold.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define EOL	"\n"
+#else
+#define	EOL	"\r\n"
+#endif
+
+// Clang has the same builtins and <cpuid.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define	CPU_DISPATCH_X86
+#include <cpuid.h>
+#endif
+
+struct CFeatureName {
+	CPU_FEATURE m_feature;
+	const char* m_option;
+	const char* m_name;
+};
+
+const CFeatureName FEATURE_NAMES[] = {
+	{CPU_SSE2,   "sse2",   "SSE2"},
+	{CPU_POPCNT, "popcnt", "POPCNT"},
+	{CPU_AVX2,   "avx2",   "AVX2"},
+	{CPU_BMI2,   "bmi2",   "BMI2"},
+	{CPU_AVX512, "avx512", "AVX-512"},
+	{CPU_PCLMUL, "pclmul", "PCLMULQDQ"}};
+
+const unsigned int FEATURE_COUNT = sizeof(FEATURE_NAMES) / sizeof(CFeatureName);
+
+static unsigned int allowed = CPU_ALL;
+
+static unsigned int detect()
+{
+	unsigned int features = 0U;
+
+#if defined(CPU_DISPATCH_X86)
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("sse2"))
+		features |= CPU_SSE2;
+	if (__builtin_cpu_supports("popcnt"))
+		features |= CPU_POPCNT;
+	if (__builtin_cpu_supports("avx2"))
+		features |= CPU_AVX2;
+	if (__builtin_cpu_supports("bmi2"))
+		features |= CPU_BMI2;
+	if (__builtin_cpu_supports("avx512f"))
+		features |= CPU_AVX512;
+	if (__builtin_cpu_supports("pclmul"))
+		features |= CPU_PCLMUL;
+#elif defined(_M_X64)
+	// Every x64 CPU has SSE2, the rest are only used from the GCC builds
+	features |= CPU_SSE2;
+#endif
+
+	return features;
+}
+
+static unsigned int detected()
+{
+	static const unsigned int features = detect();
+
+	return features;
+}
+
+bool CCPUDispatch::has(CPU_FEATURE feature)
+{
+	return (detected() & allowed & feature) == (unsigned int)feature;
+}
+
+// AMD before family 19h (Zen 3) runs PEXT as microcode, taking a cycle or
+// more for each bit of the mask
+static bool detectFastPEXT()
+{
+#if defined(CPU_DISPATCH_X86)
+	unsigned int eax, ebx, ecx, edx;
+	if (__get_cpuid(0U, &eax, &ebx, &ecx, &edx) == 0)
+		return true;
+
+	// "AuthenticAMD"
+	if (ebx != 0x68747541U || edx != 0x69746E65U || ecx != 0x444D4163U)
+		return true;
+
+	if (__get_cpuid(1U, &eax, &ebx, &ecx, &edx) == 0)
+		return true;
+
+	unsigned int family = (eax >> 8) & 0x0FU;
+	if (family == 0x0FU)
+		family += (eax >> 20) & 0xFFU;
+
+	return family >= 0x19U;
+#else
+	return true;
+#endif
+}
+
+bool CCPUDispatch::hasFastPEXT()
+{
+	static const bool fast = detectFastPEXT();
+
+	return fast;
+}
+
+bool CCPUDispatch::checkBuild()
+{
+#if defined(BIT_UTILS_POPCOUNT) && defined(CPU_DISPATCH_X86)
+	return (detected() & CPU_POPCNT) != 0U;
+#else
+	return true;
+#endif
+}
+
+unsigned int CCPUDispatch::getDetected()
+{
+	return detected();
+}
+
+unsigned int CCPUDispatch::getAllowed()
+{
+	return allowed;
+}
+
+void CCPUDispatch::setAllowed(unsigned int features)
+{
+	allowed = features & CPU_ALL;
+}
+
+bool CCPUDispatch::parse(const char* text, unsigned int& features)
+{
+	assert(text != NULL);
+
+	if (::strcmp(text, "all") == 0) {
+		features = CPU_ALL;
+		return true;
+	}
+
+	features = 0U;
+
+	if (::strcmp(text, "none") == 0)
+		return true;
+
+	while (*text != '\0') {
+		size_t length = ::strcspn(text, ",");
+
+		unsigned int i = 0U;
+		for (; i < FEATURE_COUNT; i++) {
+			if (::strlen(FEATURE_NAMES[i].m_option) == length && ::strncmp(text, FEATURE_NAMES[i].m_option, length) == 0)
+				break;
+		}
+
+		if (i == FEATURE_COUNT)
+			return false;
+
+		features |= FEATURE_NAMES[i].m_feature;
+
+		text += length;
+		if (*text == ',')
+			text++;
+	}
+
+	return true;
+}
+
+void CCPUDispatch::print()
+{
+	::fprintf(stdout, "CPU features:");
+
+	unsigned int found = 0U;
+	for (unsigned int i = 0U; i < FEATURE_COUNT; i++) {
+		if ((detected() & FEATURE_NAMES[i].m_feature) != 0U) {
+			::fprintf(stdout, " %s%s", FEATURE_NAMES[i].m_name, (allowed & FEATURE_NAMES[i].m_feature) != 0U ? "" : " (off)");
+			found++;
+		}
+	}
+
+	if (found == 0U)
+		::fprintf(stdout, " none used");
+
+	::fprintf(stdout, EOL);
+
+#if defined(BIT_UTILS_POPCOUNT)
+	const char* popcount = "instruction";
+#else
+	const char* popcount = has(CPU_POPCNT) ? "SWAR (make POPCNT=1 for the instruction)" : "SWAR";
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+	bool sse2 = has(CPU_SSE2);
+#else
+	bool sse2 = false;
+#endif
+
+	::fprintf(stdout, "FEC kernels: Golay batch %s, Viterbi %s, CRC %s, bit extract %s, popcount %s" EOL,
+		CGolayBatch::getName(CGolayBatch::getType()),
+		sse2 ? "SSE2" : "scalar",
+		CCRCFold::isSupported() ? "PCLMULQDQ" : "slicing by 8",
+		CBitExtract::isSupported() ? "PEXT" : (has(CPU_BMI2) ? "table (PEXT is slow on this CPU)" : "table"),
+		popcount);
+}
@@ -0,0 +1,64 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(CPUDISPATCH_H)
+#define	CPUDISPATCH_H
+
+enum CPU_FEATURE {
+	CPU_SSE2   = 0x01U,
+	CPU_POPCNT = 0x02U,
+	CPU_AVX2   = 0x04U,
+	CPU_BMI2   = 0x08U,
+	CPU_AVX512 = 0x10U,
+	CPU_PCLMUL = 0x20U
+};
+
+const unsigned int CPU_ALL = 0x3FU;
+
+// Finds the instruction set extensions of the CPU once, on first use. The
+// kernels that have more than one version ask has() which they may use: the
+// Golay batch decoder, the Viterbi decoders, the CRC fold and the bit extract
+// of CBitPermutation. Most of them decide when they are first used or built,
+// so setAllowed() must be called before any decoding, as main() does for the
+// -cpu option. Bit counts are inlined everywhere, so their version is fixed
+// when the program is built ("make POPCNT=1") and only reported here.
+class CCPUDispatch {
+public:
+	// True if the CPU has the feature and it hasn't been turned off
+	static bool has(CPU_FEATURE feature);
+
+	// False on AMD CPUs before Zen 3, where PEXT is microcoded and slower
+	// than a table lookup
+	static bool hasFastPEXT();
+
+	// False if the CPU lacks a feature that the whole build uses, as a
+	// "make POPCNT=1" build does for its bit counts
+	static bool checkBuild();
+
+	static unsigned int getDetected();
+	static unsigned int getAllowed();
+	static void setAllowed(unsigned int features);
+
+	// Reads "all", "none", or a list of features such as "avx2,pclmul"
+	static bool parse(const char* text, unsigned int& features);
+
+	// The features found and the version of each kernel that will be used
+	static void print();
+};
+
+#endif
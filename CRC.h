@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2015,2016 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2015,2016,2026 by Jonathan Naylor G4KLX
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -31,7 +31,14 @@ public:
 	static bool checkCCITT161(const unsigned char* in, unsigned int length);
 	static bool checkCCITT162(const unsigned char* in, unsigned int length);
 
+	// Checks count buffers of the same length, such as D-Star headers or FICHs from a capture
+	static void checkCCITT161(const unsigned char* const* in, unsigned int length, bool* valid, unsigned int count);
+	static void checkCCITT162(const unsigned char* const* in, unsigned int length, bool* valid, unsigned int count);
+
 	static unsigned char crc8(const unsigned char* in, unsigned int length);
+
+	// The size of the CCITT and CRC8 tables
+	static unsigned int getTableBytes();
 };
 
 #endif
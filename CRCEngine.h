@@ -0,0 +1,333 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(CRCENGINE_H)
+#define	CRCENGINE_H
+
+#include "BitUtils.h"
+#include "CRCFold.h"
+
+#include <cstdint>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+// Buffers shorter than this aren't worth folding
+const unsigned int CRC_FOLD_MIN_LENGTH = 64U;
+
+// Slicing by eight needs eight tables, the small build makes do with one
+#if defined(SMALL_TABLES)
+const unsigned int CRC_TABLES = 1U;
+#else
+const unsigned int CRC_TABLES = 8U;
+#endif
+
+// A table driven CRC of WIDTH bits, a multiple of eight up to 32, with the
+// usual catalogue parameters. POLY is in the normal form, with the x^WIDTH
+// term implied, and REFLECTED covers both the input and the output. The
+// tables are built on first use, eight of them for slicing by eight bytes,
+// or one in the small build, which takes the eight bytes one at a time.
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+class CCRCEngine {
+public:
+	// Picks the fastest method for the length and CPU
+	static uint32_t compute(const unsigned char* in, unsigned int length);
+
+	// The CRCs of count buffers of the same length, four at a time
+	static void compute(const unsigned char* const* in, unsigned int length, uint32_t* crcs, unsigned int count);
+
+	// The separate methods, for testing and benchmarks
+	static uint32_t computeBytes(const unsigned char* in, unsigned int length);
+	static uint32_t computeSliced(const unsigned char* in, unsigned int length);
+	static uint32_t computeFolded(const unsigned char* in, unsigned int length);
+
+	// The size of the tables, once they are built
+	static unsigned int getTableBytes();
+
+private:
+	static_assert(WIDTH >= 8U && WIDTH <= 32U && (WIDTH % 8U) == 0U, "The width must be 8, 16, 24 or 32 bits");
+
+	static const uint32_t MASK = uint32_t((uint64_t(1U) << WIDTH) - 1U);
+
+	struct CTables {
+		uint32_t m_table[CRC_TABLES][256U];
+		uint32_t m_init;
+		uint64_t m_kHi;
+		uint64_t m_kLo;
+
+		CTables();
+	};
+
+	static const CTables& tables();
+
+	static uint64_t load(const unsigned char* in);
+	static uint32_t step(uint32_t crc, unsigned char in, const CTables& t);
+	static uint32_t slice8(uint32_t crc, const unsigned char* in, const CTables& t);
+	static uint32_t update(uint32_t crc, const unsigned char* in, unsigned int length, const CTables& t);
+
+	static uint32_t reflect(uint32_t v, unsigned int bits);
+	static uint64_t xnModP(unsigned int n);
+};
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::CTables::CTables() :
+m_init(REFLECTED ? reflect(INIT, WIDTH) : INIT),
+m_kHi(0U),
+m_kLo(0U)
+{
+	// The register after one byte, with the byte in the top bits or, when reflected, the bottom
+	for (unsigned int b = 0U; b < 256U; b++) {
+		uint32_t crc;
+		if (REFLECTED) {
+			uint32_t poly = reflect(POLY, WIDTH);
+			crc = b;
+			for (unsigned int i = 0U; i < 8U; i++)
+				crc = (crc & 0x01U) ? ((crc >> 1) ^ poly) : (crc >> 1);
+		} else {
+			crc = uint32_t(b) << (WIDTH - 8U);
+			for (unsigned int i = 0U; i < 8U; i++)
+				crc = (crc & (0x01U << (WIDTH - 1U))) ? (((crc << 1) ^ POLY) & MASK) : ((crc << 1) & MASK);
+		}
+
+		m_table[0U][b] = crc;
+	}
+
+	// The same byte followed by another one to seven zero bytes
+	for (unsigned int k = 1U; k < CRC_TABLES; k++) {
+		for (unsigned int b = 0U; b < 256U; b++) {
+			uint32_t crc = m_table[k - 1U][b];
+			if (REFLECTED)
+				m_table[k][b] = (crc >> 8) ^ m_table[0U][crc & 0xFFU];
+			else
+				m_table[k][b] = ((crc << 8) & MASK) ^ m_table[0U][(crc >> (WIDTH - 8U)) & 0xFFU];
+		}
+	}
+
+	// The folding multipliers for the high and low halves of a block, see CCRCFold
+	if (REFLECTED) {
+		m_kHi = uint64_t(reflect(uint32_t(xnModP(127U)), WIDTH)) << (64U - WIDTH);
+		m_kLo = uint64_t(reflect(uint32_t(xnModP(191U)), WIDTH)) << (64U - WIDTH);
+	} else {
+		m_kHi = xnModP(192U);
+		m_kLo = xnModP(128U);
+	}
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+const typename CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::CTables& CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::tables()
+{
+	static const CTables t;
+
+	return t;
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+inline uint32_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::step(uint32_t crc, unsigned char in, const CTables& t)
+{
+	if (REFLECTED)
+		return (crc >> 8) ^ t.m_table[0U][(crc ^ in) & 0xFFU];
+	else
+		return ((crc << 8) & MASK) ^ t.m_table[0U][((crc >> (WIDTH - 8U)) ^ in) & 0xFFU];
+}
+
+// Eight bytes, the first in the low bits when reflected and in the high bits otherwise
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+inline uint64_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::load(const unsigned char* in)
+{
+	return REFLECTED ? CBitUtils::load64LE(in) : CBitUtils::load64(in);
+}
+
+// The register is added to the first bytes, then each of the eight bytes
+// looks up its own table for the number of bytes that follow it
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+inline uint32_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::slice8(uint32_t crc, const unsigned char* in, const CTables& t)
+{
+#if defined(SMALL_TABLES)
+	for (unsigned int i = 0U; i < 8U; i++)
+		crc = step(crc, in[i], t);
+
+	return crc;
+#else
+	uint64_t word = load(in);
+
+	if (REFLECTED) {
+		word ^= crc;
+
+		return t.m_table[7U][(word >> 0)  & 0xFFU] ^ t.m_table[6U][(word >> 8)  & 0xFFU] ^
+			   t.m_table[5U][(word >> 16) & 0xFFU] ^ t.m_table[4U][(word >> 24) & 0xFFU] ^
+			   t.m_table[3U][(word >> 32) & 0xFFU] ^ t.m_table[2U][(word >> 40) & 0xFFU] ^
+			   t.m_table[1U][(word >> 48) & 0xFFU] ^ t.m_table[0U][(word >> 56) & 0xFFU];
+	} else {
+		word ^= uint64_t(crc) << (64U - WIDTH);
+
+		return t.m_table[7U][(word >> 56) & 0xFFU] ^ t.m_table[6U][(word >> 48) & 0xFFU] ^
+			   t.m_table[5U][(word >> 40) & 0xFFU] ^ t.m_table[4U][(word >> 32) & 0xFFU] ^
+			   t.m_table[3U][(word >> 24) & 0xFFU] ^ t.m_table[2U][(word >> 16) & 0xFFU] ^
+			   t.m_table[1U][(word >> 8)  & 0xFFU] ^ t.m_table[0U][(word >> 0)  & 0xFFU];
+	}
+#endif
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+inline uint32_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::update(uint32_t crc, const unsigned char* in, unsigned int length, const CTables& t)
+{
+	for (; length >= 8U; length -= 8U, in += 8U)
+		crc = slice8(crc, in, t);
+
+	for (; length > 0U; length--, in++)
+		crc = step(crc, *in, t);
+
+	return crc;
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+uint32_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::compute(const unsigned char* in, unsigned int length)
+{
+	if (length >= CRC_FOLD_MIN_LENGTH) {
+		static const bool folding = CCRCFold::isSupported();
+		if (folding)
+			return computeFolded(in, length);
+	}
+
+	return computeSliced(in, length);
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+void CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::compute(const unsigned char* const* in, unsigned int length, uint32_t* crcs, unsigned int count)
+{
+	assert(in != NULL);
+	assert(crcs != NULL);
+
+	const CTables& t = tables();
+
+	// Four independent table walks hide the latency of each lookup
+	unsigned int i = 0U;
+	for (; (i + 4U) <= count; i += 4U) {
+		const unsigned char* in0 = in[i + 0U];
+		const unsigned char* in1 = in[i + 1U];
+		const unsigned char* in2 = in[i + 2U];
+		const unsigned char* in3 = in[i + 3U];
+		assert(in0 != NULL && in1 != NULL && in2 != NULL && in3 != NULL);
+
+		uint32_t crc0 = t.m_init;
+		uint32_t crc1 = t.m_init;
+		uint32_t crc2 = t.m_init;
+		uint32_t crc3 = t.m_init;
+
+		unsigned int n = 0U;
+		for (; (n + 8U) <= length; n += 8U) {
+			crc0 = slice8(crc0, in0 + n, t);
+			crc1 = slice8(crc1, in1 + n, t);
+			crc2 = slice8(crc2, in2 + n, t);
+			crc3 = slice8(crc3, in3 + n, t);
+		}
+
+		for (; n < length; n++) {
+			crc0 = step(crc0, in0[n], t);
+			crc1 = step(crc1, in1[n], t);
+			crc2 = step(crc2, in2[n], t);
+			crc3 = step(crc3, in3[n], t);
+		}
+
+		crcs[i + 0U] = crc0 ^ XOROUT;
+		crcs[i + 1U] = crc1 ^ XOROUT;
+		crcs[i + 2U] = crc2 ^ XOROUT;
+		crcs[i + 3U] = crc3 ^ XOROUT;
+	}
+
+	for (; i < count; i++)
+		crcs[i] = computeSliced(in[i], length);
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+uint32_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::computeBytes(const unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+
+	const CTables& t = tables();
+
+	uint32_t crc = t.m_init;
+	for (unsigned int i = 0U; i < length; i++)
+		crc = step(crc, in[i], t);
+
+	return crc ^ XOROUT;
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+uint32_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::computeSliced(const unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+
+	const CTables& t = tables();
+
+	return update(t.m_init, in, length, t) ^ XOROUT;
+}
+
+// The folded block stands in for the whole of the buffer that it came from,
+// with the register already added, so its CRC carries on from zero
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+uint32_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::computeFolded(const unsigned char* in, unsigned int length)
+{
+	assert(in != NULL);
+	assert(length >= 16U);
+
+	const CTables& t = tables();
+
+	unsigned int blocks = length / 16U;
+
+	unsigned char folded[16U];
+	if (REFLECTED)
+		CCRCFold::fold(in, blocks, true, t.m_kHi, t.m_kLo, 0U, t.m_init, folded);
+	else
+		CCRCFold::fold(in, blocks, false, t.m_kHi, t.m_kLo, uint64_t(t.m_init) << (64U - WIDTH), 0U, folded);
+
+	uint32_t crc = update(0U, folded, 16U, t);
+
+	return update(crc, in + blocks * 16U, length - blocks * 16U, t) ^ XOROUT;
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+unsigned int CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::getTableBytes()
+{
+	return sizeof(CTables);
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+uint32_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::reflect(uint32_t v, unsigned int bits)
+{
+	uint32_t r = 0U;
+	for (unsigned int i = 0U; i < bits; i++, v >>= 1)
+		r = (r << 1) | (v & 0x01U);
+
+	return r;
+}
+
+template <unsigned int WIDTH, uint32_t POLY, uint32_t INIT, bool REFLECTED, uint32_t XOROUT>
+uint64_t CCRCEngine<WIDTH, POLY, INIT, REFLECTED, XOROUT>::xnModP(unsigned int n)
+{
+	uint64_t r = 1U;
+	for (unsigned int i = 0U; i < n; i++) {
+		r <<= 1;
+		if ((r >> WIDTH) & 0x01U)
+			r ^= (uint64_t(1U) << WIDTH) | POLY;
+	}
+
+	return r;
+}
+
+#endif
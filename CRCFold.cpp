@@ -0,0 +1,88 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+// Only fold() is built for PCLMULQDQ, CCRCEngine only calls it if the CPU has it
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define	CRC_FOLD_PCLMUL
+#endif
+
+#include "CRCFold.h"
+#include "CPUDispatch.h"
+
+#include <cassert>
+
+#if defined(CRC_FOLD_PCLMUL)
+
+#include <wmmintrin.h>
+#include <tmmintrin.h>
+
+bool CCRCFold::isSupported()
+{
+	return CCPUDispatch::has(CPU_PCLMUL) && __builtin_cpu_supports("ssse3") != 0;
+}
+
+// A reflected block is loaded as it is, bit 0 of the first byte being the
+// highest power of x. Otherwise the bytes are swapped so the first is the most
+// significant. The reflected products come out one bit low, which is made up
+// for by the caller using x^191 and x^127 in place of x^192 and x^128.
+__attribute__((target("pclmul,ssse3")))
+void CCRCFold::fold(const unsigned char* in, unsigned int blocks, bool reflected, uint64_t kHi, uint64_t kLo, uint64_t initHi, uint64_t initLo, unsigned char* out)
+{
+	assert(in != NULL);
+	assert(out != NULL);
+	assert(blocks > 0U);
+
+	const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i k    = _mm_set_epi64x(kHi, kLo);
+
+	__m128i acc = _mm_loadu_si128((const __m128i*)in);
+	if (!reflected)
+		acc = _mm_shuffle_epi8(acc, swap);
+	acc = _mm_xor_si128(acc, _mm_set_epi64x(initHi, initLo));
+
+	if (reflected) {
+		for (unsigned int i = 1U; i < blocks; i++) {
+			__m128i block = _mm_loadu_si128((const __m128i*)(in + i * 16U));
+			acc = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x11), _mm_clmulepi64_si128(acc, k, 0x00)), block);
+		}
+
+		_mm_storeu_si128((__m128i*)out, acc);
+	} else {
+		for (unsigned int i = 1U; i < blocks; i++) {
+			__m128i block = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(in + i * 16U)), swap);
+			acc = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x11), _mm_clmulepi64_si128(acc, k, 0x00)), block);
+		}
+
+		_mm_storeu_si128((__m128i*)out, _mm_shuffle_epi8(acc, swap));
+	}
+}
+
+#else
+
+bool CCRCFold::isSupported()
+{
+	return false;
+}
+
+void CCRCFold::fold(const unsigned char* in, unsigned int blocks, bool reflected, uint64_t kHi, uint64_t kLo, uint64_t initHi, uint64_t initLo, unsigned char* out)
+{
+	// Never called, isSupported() returns false
+	assert(false);
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(CRCFOLD_H)
+#define	CRCFOLD_H
+
+#include <cstdint>
+
+// Folds a buffer of 16 byte blocks into a single block with the same CRC,
+// using carry-less multiplies. Each step multiplies the two halves of the
+// running block by x^n mod P and adds the next block. CCRCEngine works out
+// the multipliers and only calls this when isSupported() is true.
+class CCRCFold {
+public:
+	static bool isSupported();
+
+	// The init values are added to the first block, out is the folded block
+	static void fold(const unsigned char* in, unsigned int blocks, bool reflected, uint64_t kHi, uint64_t kLo, uint64_t initHi, uint64_t initLo, unsigned char* out);
+};
+
+#endif
@@ -1,13 +1,17 @@
 /*
- *   Copyright (C) 2010,2016 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2010,2016,2026 by Jonathan Naylor G4KLX
  *   Copyright (C) 2002 by Robert H. Morelos-Zaragoza. All rights reserved.
  */
 
 #include "Golay24128.h"
+#include "BitUtils.h"
 
+#include <cstdint>
 #include <cstdio>
 #include <cassert>
+#include <new>
 
+#if !defined(SMALL_TABLES)
 const unsigned int ENCODING_TABLE_23127[] = {
 	0x000000U, 0x0018EAU, 0x00293EU, 0x0031D4U, 0x004A96U, 0x00527CU, 0x0063A8U, 0x007B42U, 0x008DC6U, 0x00952CU, 
 	0x00A4F8U, 0x00BC12U, 0x00C750U, 0x00DFBAU, 0x00EE6EU, 0x00F684U, 0x010366U, 0x011B8CU, 0x012A58U, 0x0132B2U, 
@@ -832,212 +836,260 @@ static const unsigned int ENCODING_TABLE_24128[] = {
 	0xFF097BU, 0xFF1190U, 0xFF2045U, 0xFF38AEU, 0xFF43ECU, 0xFF5B07U, 0xFF6AD2U, 0xFF7239U, 0xFF84BDU, 0xFF9C56U, 
 	0xFFAD83U, 0xFFB568U, 0xFFCE2AU, 0xFFD6C1U, 0xFFE714U, 0xFFFFFFU};
 
+// The error pattern of each syndrome, with its weight in the top bits
 static const unsigned int DECODING_TABLE_23127[] = {
-	0x000000U, 0x000001U, 0x000002U, 0x000003U, 0x000004U, 0x000005U, 0x000006U, 0x000007U, 0x000008U, 0x000009U, 
-	0x00000AU, 0x00000BU, 0x00000CU, 0x00000DU, 0x00000EU, 0x024020U, 0x000010U, 0x000011U, 0x000012U, 0x000013U, 
-	0x000014U, 0x000015U, 0x000016U, 0x412000U, 0x000018U, 0x000019U, 0x00001AU, 0x180800U, 0x00001CU, 0x200300U, 
-	0x048040U, 0x001480U, 0x000020U, 0x000021U, 0x000022U, 0x000023U, 0x000024U, 0x000025U, 0x000026U, 0x024008U, 
-	0x000028U, 0x000029U, 0x00002AU, 0x024004U, 0x00002CU, 0x024002U, 0x024001U, 0x024000U, 0x000030U, 0x000031U, 
-	0x000032U, 0x008180U, 0x000034U, 0x000C40U, 0x301000U, 0x0C0200U, 0x000038U, 0x043000U, 0x400600U, 0x210040U, 
-	0x090080U, 0x508000U, 0x002900U, 0x024010U, 0x000040U, 0x000041U, 0x000042U, 0x000043U, 0x000044U, 0x000045U, 
-	0x000046U, 0x280080U, 0x000048U, 0x000049U, 0x00004AU, 0x002500U, 0x00004CU, 0x111000U, 0x048010U, 0x400A00U, 
-	0x000050U, 0x000051U, 0x000052U, 0x021200U, 0x000054U, 0x000C20U, 0x048008U, 0x104100U, 0x000058U, 0x404080U, 
-	0x048004U, 0x210020U, 0x048002U, 0x0A2000U, 0x048000U, 0x048001U, 0x000060U, 0x000061U, 0x000062U, 0x540000U, 
-	0x000064U, 0x000C10U, 0x010300U, 0x00B000U, 0x000068U, 0x088200U, 0x001880U, 0x210010U, 0x602000U, 0x040180U, 
-	0x180400U, 0x024040U, 0x000070U, 0x000C04U, 0x086000U, 0x210008U, 0x000C01U, 0x000C00U, 0x420080U, 0x000C02U, 
-	0x120100U, 0x210002U, 0x210001U, 0x210000U, 0x005200U, 0x000C08U, 0x048020U, 0x210004U, 0x000080U, 0x000081U, 
-	0x000082U, 0x000083U, 0x000084U, 0x000085U, 0x000086U, 0x280040U, 0x000088U, 0x000089U, 0x00008AU, 0x050200U, 
-	0x00008CU, 0x00A800U, 0x500100U, 0x001410U, 0x000090U, 0x000091U, 0x000092U, 0x008120U, 0x000094U, 0x160000U, 
-	0x004A00U, 0x001408U, 0x000098U, 0x404040U, 0x222000U, 0x001404U, 0x090020U, 0x001402U, 0x001401U, 0x001400U, 
-	0x0000A0U, 0x0000A1U, 0x0000A2U, 0x008110U, 0x0000A4U, 0x401200U, 0x042400U, 0x110800U, 0x0000A8U, 0x300400U, 
-	0x001840U, 0x482000U, 0x090010U, 0x040140U, 0x208200U, 0x024080U, 0x0000B0U, 0x008102U, 0x008101U, 0x008100U, 
-	0x090008U, 0x206000U, 0x420040U, 0x008104U, 0x090004U, 0x020A00U, 0x144000U, 0x008108U, 0x090000U, 0x090001U, 
-	0x090002U, 0x001420U, 0x0000C0U, 0x0000C1U, 0x0000C2U, 0x280004U, 0x0000C4U, 0x280002U, 0x280001U, 0x280000U, 
-	0x0000C8U, 0x404010U, 0x001820U, 0x128000U, 0x020600U, 0x040120U, 0x016000U, 0x280008U, 0x0000D0U, 0x404008U, 
-	0x110400U, 0x042800U, 0x003100U, 0x018200U, 0x420020U, 0x280010U, 0x404001U, 0x404000U, 0x080300U, 0x404002U, 
-	0x300800U, 0x404004U, 0x048080U, 0x001440U, 0x0000E0U, 0x032000U, 0x001808U, 0x004600U, 0x10C000U, 0x040108U, 
-	0x420010U, 0x280020U, 0x001802U, 0x040104U, 0x001800U, 0x001801U, 0x040101U, 0x040100U, 0x001804U, 0x040102U, 
-	0x240200U, 0x181000U, 0x420004U, 0x008140U, 0x420002U, 0x000C80U, 0x420000U, 0x420001U, 0x00A400U, 0x404020U, 
-	0x001810U, 0x210080U, 0x090040U, 0x040110U, 0x420008U, 0x102200U, 0x000100U, 0x000101U, 0x000102U, 0x000103U, 
-	0x000104U, 0x000105U, 0x000106U, 0x041800U, 0x000108U, 0x000109U, 0x00010AU, 0x002440U, 0x00010CU, 0x200210U, 
-	0x500080U, 0x098000U, 0x000110U, 0x000111U, 0x000112U, 0x0080A0U, 0x000114U, 0x200208U, 0x0A0400U, 0x104040U, 
-	0x000118U, 0x200204U, 0x015000U, 0x460000U, 0x200201U, 0x200200U, 0x002820U, 0x200202U, 0x000120U, 0x000121U, 
-	0x000122U, 0x008090U, 0x000124U, 0x182000U, 0x010240U, 0x600400U, 0x000128U, 0x410800U, 0x2C0000U, 0x101200U, 
-	0x009400U, 0x0400C0U, 0x002810U, 0x024100U, 0x000130U, 0x008082U, 0x008081U, 0x008080U, 0x444000U, 0x031000U, 
-	0x002808U, 0x008084U, 0x120040U, 0x084400U, 0x002804U, 0x008088U, 0x002802U, 0x200220U, 0x002800U, 0x002801U, 
-	0x000140U, 0x000141U, 0x000142U, 0x002408U, 0x000144U, 0x428000U, 0x010220U, 0x104010U, 0x000148U, 0x002402U, 
-	0x002401U, 0x002400U, 0x084800U, 0x0400A0U, 0x221000U, 0x002404U, 0x000150U, 0x0D0000U, 0x600800U, 0x104004U, 
-	0x003080U, 0x104002U, 0x104001U, 0x104000U, 0x120020U, 0x009800U, 0x080280U, 0x002410U, 0x410400U, 0x200240U, 
-	0x048100U, 0x104008U, 0x000160U, 0x205000U, 0x010204U, 0x0A0800U, 0x010202U, 0x040088U, 0x010200U, 0x010201U, 
-	0x120010U, 0x040084U, 0x40C000U, 0x002420U, 0x040081U, 0x040080U, 0x010208U, 0x040082U, 0x120008U, 0x402200U, 
-	0x041400U, 0x0080C0U, 0x288000U, 0x000D00U, 0x010210U, 0x104020U, 0x120000U, 0x120001U, 0x120002U, 0x210100U, 
-	0x120004U, 0x040090U, 0x002840U, 0x481000U, 0x000180U, 0x000181U, 0x000182U, 0x008030U, 0x000184U, 0x014400U, 
-	0x500008U, 0x022200U, 0x000188U, 0x0A1000U, 0x500004U, 0x204800U, 0x500002U, 0x040060U, 0x500000U, 0x500001U, 
-	0x000190U, 0x008022U, 0x008021U, 0x008020U, 0x003040U, 0x480800U, 0x250000U, 0x008024U, 0x040C00U, 0x112000U, 
-	0x080240U, 0x008028U, 0x02C000U, 0x200280U, 0x500010U, 0x001500U, 0x0001A0U, 0x008012U, 0x008011U, 0x008010U, 
-	0x220800U, 0x040048U, 0x085000U, 0x008014U, 0x006200U, 0x040044U, 0x030400U, 0x008018U, 0x040041U, 0x040040U, 
-	0x500020U, 0x040042U, 0x008003U, 0x008002U, 0x008001U, 0x008000U, 0x100600U, 0x008006U, 0x008005U, 0x008004U, 
-	0x601000U, 0x00800AU, 0x008009U, 0x008008U, 0x090100U, 0x040050U, 0x002880U, 0x00800CU, 0x0001C0U, 0x100A00U, 
-	0x064000U, 0x411000U, 0x003010U, 0x040028U, 0x008C00U, 0x280100U, 0x218000U, 0x040024U, 0x080210U, 0x002480U, 
-	0x040021U, 0x040020U, 0x500040U, 0x040022U, 0x003004U, 0x220400U, 0x080208U, 0x008060U, 0x003000U, 0x003001U, 
-	0x003002U, 0x104080U, 0x080202U, 0x404100U, 0x080200U, 0x080201U, 0x003008U, 0x040030U, 0x080204U, 0x030800U, 
-	0x480400U, 0x04000CU, 0x302000U, 0x008050U, 0x040009U, 0x040008U, 0x010280U, 0x04000AU, 0x040005U, 0x040004U, 
-	0x001900U, 0x040006U, 0x040001U, 0x040000U, 0x040003U, 0x040002U, 0x014800U, 0x008042U, 0x008041U, 0x008040U, 
-	0x003020U, 0x040018U, 0x420100U, 0x008044U, 0x120080U, 0x040014U, 0x080220U, 0x008048U, 0x040011U, 0x040010U, 
-	0x204400U, 0x040012U, 0x000200U, 0x000201U, 0x000202U, 0x000203U, 0x000204U, 0x000205U, 0x000206U, 0x108400U, 
-	0x000208U, 0x000209U, 0x00020AU, 0x050080U, 0x00020CU, 0x200110U, 0x083000U, 0x400840U, 0x000210U, 0x000211U, 
-	0x000212U, 0x021040U, 0x000214U, 0x200108U, 0x004880U, 0x0C0020U, 0x000218U, 0x200104U, 0x400420U, 0x00E000U, 
-	0x200101U, 0x200100U, 0x130000U, 0x200102U, 0x000220U, 0x000221U, 0x000222U, 0x202800U, 0x000224U, 0x401080U, 
-	0x010140U, 0x0C0010U, 0x000228U, 0x088040U, 0x400410U, 0x101100U, 0x140800U, 0x012400U, 0x208080U, 0x024200U, 
-	0x000230U, 0x114000U, 0x400408U, 0x0C0004U, 0x02A000U, 0x0C0002U, 0x0C0001U, 0x0C0000U, 0x400402U, 0x020880U, 
-	0x400400U, 0x400401U, 0x005040U, 0x200120U, 0x400404U, 0x0C0008U, 0x000240U, 0x000241U, 0x000242U, 0x021010U, 
-	0x000244U, 0x046000U, 0x010120U, 0x400808U, 0x000248U, 0x088020U, 0x304000U, 0x400804U, 0x020480U, 0x400802U, 
-	0x400801U, 0x400800U, 0x000250U, 0x021002U, 0x021001U, 0x021000U, 0x580000U, 0x018080U, 0x202400U, 0x021004U, 
-	0x012800U, 0x140400U, 0x080180U, 0x021008U, 0x005020U, 0x200140U, 0x048200U, 0x400810U, 0x000260U, 0x088008U, 
-	0x010104U, 0x004480U, 0x010102U, 0x320000U, 0x010100U, 0x010101U, 0x088001U, 0x088000U, 0x062000U, 0x088002U, 
-	0x005010U, 0x088004U, 0x010108U, 0x400820U, 0x240080U, 0x402100U, 0x108800U, 0x021020U, 0x005008U, 0x000E00U, 
-	0x010110U, 0x0C0040U, 0x005004U, 0x088010U, 0x400440U, 0x210200U, 0x005000U, 0x005001U, 0x005002U, 0x102080U, 
-	0x000280U, 0x000281U, 0x000282U, 0x050008U, 0x000284U, 0x401020U, 0x004810U, 0x022100U, 0x000288U, 0x050002U, 
-	0x050001U, 0x050000U, 0x020440U, 0x184000U, 0x208020U, 0x050004U, 0x000290U, 0x082400U, 0x004804U, 0x700000U, 
-	0x004802U, 0x018040U, 0x004800U, 0x004801U, 0x109000U, 0x020820U, 0x080140U, 0x050010U, 0x442000U, 0x200180U, 
-	0x004808U, 0x001600U, 0x0002A0U, 0x401004U, 0x1A0000U, 0x004440U, 0x401001U, 0x401000U, 0x208008U, 0x401002U, 
-	0x006100U, 0x020810U, 0x208004U, 0x050020U, 0x208002U, 0x401008U, 0x208000U, 0x208001U, 0x240040U, 0x020808U, 
-	0x013000U, 0x008300U, 0x100500U, 0x401010U, 0x004820U, 0x0C0080U, 0x020801U, 0x020800U, 0x400480U, 0x020802U, 
-	0x090200U, 0x020804U, 0x208010U, 0x102040U, 0x0002C0U, 0x100900U, 0x40A000U, 0x004420U, 0x020408U, 0x018010U, 
-	0x141000U, 0x280200U, 0x020404U, 0x203000U, 0x080110U, 0x050040U, 0x020400U, 0x020401U, 0x020402U, 0x400880U, 
-	0x240020U, 0x018004U, 0x080108U, 0x021080U, 0x018001U, 0x018000U, 0x004840U, 0x018002U, 0x080102U, 0x404200U, 
-	0x080100U, 0x080101U, 0x020410U, 0x018008U, 0x080104U, 0x102020U, 0x240010U, 0x004402U, 0x004401U, 0x004400U, 
-	0x082800U, 0x401040U, 0x010180U, 0x004404U, 0x510000U, 0x088080U, 0x001A00U, 0x004408U, 0x020420U, 0x040300U, 
-	0x208040U, 0x102010U, 0x240000U, 0x240001U, 0x240002U, 0x004410U, 0x240004U, 0x018020U, 0x420200U, 0x102008U, 
-	0x240008U, 0x020840U, 0x080120U, 0x102004U, 0x005080U, 0x102002U, 0x102001U, 0x102000U, 0x000300U, 0x000301U, 
-	0x000302U, 0x484000U, 0x000304U, 0x200018U, 0x010060U, 0x022080U, 0x000308U, 0x200014U, 0x028800U, 0x101020U, 
-	0x200011U, 0x200010U, 0x044400U, 0x200012U, 0x000310U, 0x20000CU, 0x142000U, 0x010C00U, 0x200009U, 0x200008U, 
-	0x409000U, 0x20000AU, 0x200005U, 0x200004U, 0x0800C0U, 0x200006U, 0x200001U, 0x200000U, 0x200003U, 0x200002U, 
-	0x000320U, 0x060400U, 0x010044U, 0x101008U, 0x010042U, 0x00C800U, 0x010040U, 0x010041U, 0x006080U, 0x101002U, 
-	0x101001U, 0x101000U, 0x4A0000U, 0x200030U, 0x010048U, 0x101004U, 0x081800U, 0x402040U, 0x224000U, 0x008280U, 
-	0x100480U, 0x200028U, 0x010050U, 0x0C0100U, 0x058000U, 0x200024U, 0x400500U, 0x101010U, 0x200021U, 0x200020U, 
-	0x002A00U, 0x200022U, 0x000340U, 0x100880U, 0x010024U, 0x248000U, 0x010022U, 0x081400U, 0x010020U, 0x010021U, 
-	0x441000U, 0x034000U, 0x080090U, 0x002600U, 0x10A000U, 0x200050U, 0x010028U, 0x400900U, 0x00C400U, 0x402020U, 
-	0x080088U, 0x021100U, 0x060800U, 0x200048U, 0x010030U, 0x104200U, 0x080082U, 0x200044U, 0x080080U, 0x080081U, 
-	0x200041U, 0x200040U, 0x080084U, 0x200042U, 0x010006U, 0x402010U, 0x010004U, 0x010005U, 0x010002U, 0x010003U, 
-	0x010000U, 0x010001U, 0x200C00U, 0x088100U, 0x01000CU, 0x101040U, 0x01000AU, 0x040280U, 0x010008U, 0x010009U, 
-	0x402001U, 0x402000U, 0x010014U, 0x402002U, 0x010012U, 0x402004U, 0x010010U, 0x010011U, 0x120200U, 0x402008U, 
-	0x0800A0U, 0x044800U, 0x005100U, 0x200060U, 0x010018U, 0x028400U, 0x000380U, 0x100840U, 0x201400U, 0x022004U, 
-	0x0C8000U, 0x022002U, 0x022001U, 0x022000U, 0x006020U, 0x408400U, 0x080050U, 0x050100U, 0x011800U, 0x200090U, 
-	0x500200U, 0x022008U, 0x430000U, 0x045000U, 0x080048U, 0x008220U, 0x100420U, 0x200088U, 0x004900U, 0x022010U, 
-	0x080042U, 0x200084U, 0x080040U, 0x080041U, 0x200081U, 0x200080U, 0x080044U, 0x200082U, 0x006008U, 0x290000U, 
-	0x440800U, 0x008210U, 0x100410U, 0x401100U, 0x0100C0U, 0x022020U, 0x006000U, 0x006001U, 0x006002U, 0x101080U, 
-	0x006004U, 0x040240U, 0x208100U, 0x080C00U, 0x100404U, 0x008202U, 0x008201U, 0x008200U, 0x100400U, 0x100401U, 
-	0x100402U, 0x008204U, 0x006010U, 0x020900U, 0x080060U, 0x008208U, 0x100408U, 0x2000A0U, 0x061000U, 0x414000U, 
-	0x100801U, 0x100800U, 0x080018U, 0x100802U, 0x604000U, 0x100804U, 0x0100A0U, 0x022040U, 0x080012U, 0x100808U, 
-	0x080010U, 0x080011U, 0x020500U, 0x040220U, 0x080014U, 0x00D000U, 0x08000AU, 0x100810U, 0x080008U, 0x080009U, 
-	0x003200U, 0x018100U, 0x08000CU, 0x440400U, 0x080002U, 0x080003U, 0x080000U, 0x080001U, 0x080006U, 0x2000C0U, 
-	0x080004U, 0x080005U, 0x029000U, 0x100820U, 0x010084U, 0x004500U, 0x010082U, 0x040208U, 0x010080U, 0x010081U, 
-	0x006040U, 0x040204U, 0x080030U, 0x620000U, 0x040201U, 0x040200U, 0x010088U, 0x040202U, 0x240100U, 0x402080U, 
-	0x080028U, 0x008240U, 0x100440U, 0x0A4000U, 0x010090U, 0x201800U, 0x080022U, 0x011400U, 0x080020U, 0x080021U, 
-	0x408800U, 0x040210U, 0x080024U, 0x102100U, 0x000400U, 0x000401U, 0x000402U, 0x000403U, 0x000404U, 0x000405U, 
-	0x000406U, 0x108200U, 0x000408U, 0x000409U, 0x00040AU, 0x002140U, 0x00040CU, 0x4C0000U, 0x210800U, 0x001090U, 
-	0x000410U, 0x000411U, 0x000412U, 0x244000U, 0x000414U, 0x000860U, 0x0A0100U, 0x001088U, 0x000418U, 0x038000U, 
-	0x400220U, 0x001084U, 0x106000U, 0x001082U, 0x001081U, 0x001080U, 0x000420U, 0x000421U, 0x000422U, 0x091000U, 
-	0x000424U, 0x000850U, 0x042080U, 0x600100U, 0x000428U, 0x300080U, 0x400210U, 0x048800U, 0x009100U, 0x012200U, 
-	0x180040U, 0x024400U, 0x000430U, 0x000844U, 0x400208U, 0x122000U, 0x000841U, 0x000840U, 0x01C000U, 0x000842U, 
-	0x400202U, 0x084100U, 0x400200U, 0x400201U, 0x260000U, 0x000848U, 0x400204U, 0x0010A0U, 0x000440U, 0x000441U, 
-	0x000442U, 0x002108U, 0x000444U, 0x000830U, 0x405000U, 0x070000U, 0x000448U, 0x002102U, 0x002101U, 0x002100U, 
-	0x020280U, 0x20C000U, 0x180020U, 0x002104U, 0x000450U, 0x000824U, 0x110080U, 0x488000U, 0x000821U, 0x000820U, 
-	0x202200U, 0x000822U, 0x281000U, 0x140200U, 0x024800U, 0x002110U, 0x410100U, 0x000828U, 0x048400U, 0x0010C0U, 
-	0x000460U, 0x000814U, 0x228000U, 0x004280U, 0x000811U, 0x000810U, 0x180008U, 0x000812U, 0x054000U, 0x421000U, 
-	0x180004U, 0x002120U, 0x180002U, 0x000818U, 0x180000U, 0x180001U, 0x000805U, 0x000804U, 0x041100U, 0x000806U, 
-	0x000801U, 0x000800U, 0x000803U, 0x000802U, 0x00A080U, 0x00080CU, 0x400240U, 0x210400U, 0x000809U, 0x000808U, 
-	0x180010U, 0x00080AU, 0x000480U, 0x000481U, 0x000482U, 0x420800U, 0x000484U, 0x014100U, 0x042020U, 0x001018U, 
-	0x000488U, 0x300020U, 0x08C000U, 0x001014U, 0x020240U, 0x001012U, 0x001011U, 0x001010U, 0x000490U, 0x082200U, 
-	0x110040U, 0x00100CU, 0x608000U, 0x00100AU, 0x001009U, 0x001008U, 0x040900U, 0x001006U, 0x001005U, 0x001004U, 
-	0x001003U, 0x001002U, 0x001001U, 0x001000U, 0x0004A0U, 0x300008U, 0x042004U, 0x004240U, 0x042002U, 0x0A8000U, 
-	0x042000U, 0x042001U, 0x300001U, 0x300000U, 0x030100U, 0x300002U, 0x404800U, 0x300004U, 0x042008U, 0x001030U, 
-	0x025000U, 0x450000U, 0x280800U, 0x008500U, 0x100300U, 0x0008C0U, 0x042010U, 0x001028U, 0x00A040U, 0x300010U, 
-	0x400280U, 0x001024U, 0x090400U, 0x001022U, 0x001021U, 0x001020U, 0x0004C0U, 0x049000U, 0x110010U, 0x004220U, 
-	0x020208U, 0x502000U, 0x008900U, 0x280400U, 0x020204U, 0x090800U, 0x640000U, 0x002180U, 0x020200U, 0x020201U, 
-	0x020202U, 0x001050U, 0x110002U, 0x220100U, 0x110000U, 0x110001U, 0x0C4000U, 0x0008A0U, 0x110004U, 0x001048U, 
-	0x00A020U, 0x404400U, 0x110008U, 0x001044U, 0x020210U, 0x001042U, 0x001041U, 0x001040U, 0x480100U, 0x004202U, 
-	0x004201U, 0x004200U, 0x211000U, 0x000890U, 0x042040U, 0x004204U, 0x00A010U, 0x300040U, 0x001C00U, 0x004208U, 
-	0x020220U, 0x040500U, 0x180080U, 0x418000U, 0x00A008U, 0x000884U, 0x110020U, 0x004210U, 0x000881U, 0x000880U, 
-	0x420400U, 0x000882U, 0x00A000U, 0x00A001U, 0x00A002U, 0x0E0000U, 0x00A004U, 0x000888U, 0x204100U, 0x001060U, 
-	0x000500U, 0x000501U, 0x000502U, 0x002048U, 0x000504U, 0x014080U, 0x0A0010U, 0x600020U, 0x000508U, 0x002042U, 
-	0x002041U, 0x002040U, 0x009020U, 0x120800U, 0x044200U, 0x002044U, 0x000510U, 0x501000U, 0x0A0004U, 0x010A00U, 
-	0x0A0002U, 0x04A000U, 0x0A0000U, 0x0A0001U, 0x040880U, 0x084020U, 0x308000U, 0x002050U, 0x410040U, 0x200600U, 
-	0x0A0008U, 0x001180U, 0x000520U, 0x060200U, 0x104800U, 0x600004U, 0x009008U, 0x600002U, 0x600001U, 0x600000U, 
-	0x009004U, 0x084010U, 0x030080U, 0x002060U, 0x009000U, 0x009001U, 0x009002U, 0x600008U, 0x212000U, 0x084008U, 
-	0x041040U, 0x008480U, 0x100280U, 0x000940U, 0x0A0020U, 0x600010U, 0x084001U, 0x084000U, 0x400300U, 0x084002U, 
-	0x009010U, 0x084004U, 0x002C00U, 0x150000U, 0x000540U, 0x00200AU, 0x002009U, 0x002008U, 0x340000U, 0x081200U, 
-	0x008880U, 0x00200CU, 0x002003U, 0x002002U, 0x002001U, 0x002000U, 0x410010U, 0x002006U, 0x002005U, 0x002004U, 
-	0x00C200U, 0x220080U, 0x041020U, 0x002018U, 0x410008U, 0x000920U, 0x0A0040U, 0x104400U, 0x410004U, 0x002012U, 
-	0x002011U, 0x002010U, 0x410000U, 0x410001U, 0x410002U, 0x002014U, 0x480080U, 0x118000U, 0x041010U, 0x002028U, 
-	0x026000U, 0x000910U, 0x010600U, 0x600040U, 0x200A00U, 0x002022U, 0x002021U, 0x002020U, 0x009040U, 0x040480U, 
-	0x180100U, 0x002024U, 0x041002U, 0x000904U, 0x041000U, 0x041001U, 0x000901U, 0x000900U, 0x041004U, 0x000902U, 
-	0x120400U, 0x084040U, 0x041008U, 0x002030U, 0x410020U, 0x000908U, 0x204080U, 0x028200U, 0x000580U, 0x014004U, 
-	0x201200U, 0x1C0000U, 0x014001U, 0x014000U, 0x008840U, 0x014002U, 0x040810U, 0x408200U, 0x030020U, 0x0020C0U, 
-	0x282000U, 0x014008U, 0x500400U, 0x001110U, 0x040808U, 0x220040U, 0x406000U, 0x008420U, 0x100220U, 0x014010U, 
-	0x0A0080U, 0x001108U, 0x040800U, 0x040801U, 0x040802U, 0x001104U, 0x040804U, 0x001102U, 0x001101U, 0x001100U, 
-	0x480040U, 0x003800U, 0x030008U, 0x008410U, 0x100210U, 0x014020U, 0x042100U, 0x600080U, 0x030002U, 0x300100U, 
-	0x030000U, 0x030001U, 0x009080U, 0x040440U, 0x030004U, 0x080A00U, 0x100204U, 0x008402U, 0x008401U, 0x008400U, 
-	0x100200U, 0x100201U, 0x100202U, 0x008404U, 0x040820U, 0x084080U, 0x030010U, 0x008408U, 0x100208U, 0x422000U, 
-	0x204040U, 0x001120U, 0x480020U, 0x220010U, 0x008804U, 0x002088U, 0x008802U, 0x014040U, 0x008800U, 0x008801U, 
-	0x105000U, 0x002082U, 0x002081U, 0x002080U, 0x020300U, 0x040420U, 0x008808U, 0x002084U, 0x220001U, 0x220000U, 
-	0x110100U, 0x220002U, 0x003400U, 0x220004U, 0x008810U, 0x440200U, 0x040840U, 0x220008U, 0x080600U, 0x002090U, 
-	0x410080U, 0x188000U, 0x204020U, 0x001140U, 0x480000U, 0x480001U, 0x480002U, 0x004300U, 0x480004U, 0x040408U, 
-	0x008820U, 0x121000U, 0x480008U, 0x040404U, 0x030040U, 0x0020A0U, 0x040401U, 0x040400U, 0x204010U, 0x040402U, 
-	0x480010U, 0x220020U, 0x041080U, 0x008440U, 0x100240U, 0x000980U, 0x204008U, 0x092000U, 0x00A100U, 0x011200U, 
-	0x204004U, 0x500800U, 0x204002U, 0x040410U, 0x204000U, 0x204001U, 0x000600U, 0x000601U, 0x000602U, 0x108004U, 
-	0x000604U, 0x108002U, 0x108001U, 0x108000U, 0x000608U, 0x005800U, 0x400030U, 0x2A0000U, 0x0200C0U, 0x012020U, 
-	0x044100U, 0x108008U, 0x000610U, 0x082080U, 0x400028U, 0x010900U, 0x051000U, 0x424000U, 0x202040U, 0x108010U, 
-	0x400022U, 0x140040U, 0x400020U, 0x400021U, 0x088800U, 0x200500U, 0x400024U, 0x001280U, 0x000620U, 0x060100U, 
-	0x400018U, 0x0040C0U, 0x284000U, 0x012008U, 0x021800U, 0x108020U, 0x400012U, 0x012004U, 0x400010U, 0x400011U, 
-	0x012001U, 0x012000U, 0x400014U, 0x012002U, 0x40000AU, 0x209000U, 0x400008U, 0x400009U, 0x100180U, 0x000A40U, 
-	0x40000CU, 0x0C0400U, 0x400002U, 0x400003U, 0x400000U, 0x400001U, 0x400006U, 0x012010U, 0x400004U, 0x400005U, 
-	0x000640U, 0x610000U, 0x0C0800U, 0x0040A0U, 0x020088U, 0x081100U, 0x202010U, 0x108040U, 0x020084U, 0x140010U, 
-	0x019000U, 0x002300U, 0x020080U, 0x020081U, 0x020082U, 0x400C00U, 0x00C100U, 0x140008U, 0x202004U, 0x021400U, 
-	0x202002U, 0x000A20U, 0x202000U, 0x202001U, 0x140001U, 0x140000U, 0x400060U, 0x140002U, 0x020090U, 0x140004U, 
-	0x202008U, 0x094000U, 0x103000U, 0x004082U, 0x004081U, 0x004080U, 0x448000U, 0x000A10U, 0x010500U, 0x004084U, 
-	0x200900U, 0x088400U, 0x400050U, 0x004088U, 0x0200A0U, 0x012040U, 0x180200U, 0x241000U, 0x0B0000U, 0x000A04U, 
-	0x400048U, 0x004090U, 0x000A01U, 0x000A00U, 0x202020U, 0x000A02U, 0x400042U, 0x140020U, 0x400040U, 0x400041U, 
-	0x005400U, 0x000A08U, 0x400044U, 0x028100U, 0x000680U, 0x082010U, 0x201100U, 0x004060U, 0x020048U, 0x240800U, 
-	0x490000U, 0x108080U, 0x020044U, 0x408100U, 0x102800U, 0x050400U, 0x020040U, 0x020041U, 0x020042U, 0x001210U, 
-	0x082001U, 0x082000U, 0x068000U, 0x082002U, 0x100120U, 0x082004U, 0x004C00U, 0x001208U, 0x214000U, 0x082008U, 
-	0x4000A0U, 0x001204U, 0x020050U, 0x001202U, 0x001201U, 0x001200U, 0x018800U, 0x004042U, 0x004041U, 0x004040U, 
-	0x100110U, 0x401400U, 0x042200U, 0x004044U, 0x0C1000U, 0x300200U, 0x400090U, 0x004048U, 0x020060U, 0x012080U, 
-	0x208400U, 0x080900U, 0x100104U, 0x082020U, 0x400088U, 0x004050U, 0x100100U, 0x100101U, 0x100102U, 0x230000U, 
-	0x400082U, 0x020C00U, 0x400080U, 0x400081U, 0x100108U, 0x04C000U, 0x400084U, 0x001220U, 0x02000CU, 0x004022U, 
-	0x004021U, 0x004020U, 0x020008U, 0x020009U, 0x02000AU, 0x004024U, 0x020004U, 0x020005U, 0x020006U, 0x004028U, 
-	0x020000U, 0x020001U, 0x020002U, 0x020003U, 0x401800U, 0x082040U, 0x110200U, 0x004030U, 0x020018U, 0x018400U, 
-	0x202080U, 0x440100U, 0x020014U, 0x140080U, 0x080500U, 0x208800U, 0x020010U, 0x020011U, 0x020012U, 0x001240U, 
-	0x004003U, 0x004002U, 0x004001U, 0x004000U, 0x020028U, 0x004006U, 0x004005U, 0x004004U, 0x020024U, 0x00400AU, 
-	0x004009U, 0x004008U, 0x020020U, 0x020021U, 0x020022U, 0x00400CU, 0x240400U, 0x004012U, 0x004011U, 0x004010U, 
-	0x100140U, 0x000A80U, 0x089000U, 0x004014U, 0x00A200U, 0x011100U, 0x4000C0U, 0x004018U, 0x020030U, 0x680000U, 
-	0x050800U, 0x102400U, 0x000700U, 0x060020U, 0x201080U, 0x010810U, 0x402800U, 0x081040U, 0x044008U, 0x108100U, 
-	0x190000U, 0x408080U, 0x044004U, 0x002240U, 0x044002U, 0x200410U, 0x044000U, 0x044001U, 0x00C040U, 0x010802U, 
-	0x010801U, 0x010800U, 0x1000A0U, 0x200408U, 0x0A0200U, 0x010804U, 0x023000U, 0x200404U, 0x400120U, 0x010808U, 
-	0x200401U, 0x200400U, 0x044010U, 0x200402U, 0x060001U, 0x060000U, 0x08A000U, 0x060002U, 0x100090U, 0x060004U, 
-	0x010440U, 0x600200U, 0x200840U, 0x060008U, 0x400110U, 0x101400U, 0x009200U, 0x012100U, 0x044020U, 0x080880U, 
-	0x100084U, 0x060010U, 0x400108U, 0x010820U, 0x100080U, 0x100081U, 0x100082U, 0x007000U, 0x400102U, 0x084200U, 
-	0x400100U, 0x400101U, 0x100088U, 0x200420U, 0x400104U, 0x028040U, 0x00C010U, 0x081004U, 0x520000U, 0x002208U, 
-	0x081001U, 0x081000U, 0x010420U, 0x081002U, 0x200820U, 0x002202U, 0x002201U, 0x002200U, 0x020180U, 0x081008U, 
-	0x044040U, 0x002204U, 0x00C000U, 0x00C001U, 0x00C002U, 0x010840U, 0x00C004U, 0x081010U, 0x202100U, 0x440080U, 
-	0x00C008U, 0x140100U, 0x080480U, 0x002210U, 0x410200U, 0x200440U, 0x101800U, 0x028020U, 0x200808U, 0x060040U, 
-	0x010404U, 0x004180U, 0x010402U, 0x081020U, 0x010400U, 0x010401U, 0x200800U, 0x200801U, 0x200802U, 0x002220U, 
-	0x200804U, 0x504000U, 0x010408U, 0x028010U, 0x00C020U, 0x402400U, 0x041200U, 0x380000U, 0x1000C0U, 0x000B00U, 
-	0x010410U, 0x028008U, 0x200810U, 0x011080U, 0x400140U, 0x028004U, 0x0C2000U, 0x028002U, 0x028001U, 0x028000U, 
-	0x201002U, 0x408008U, 0x201000U, 0x201001U, 0x100030U, 0x014200U, 0x201004U, 0x022400U, 0x408001U, 0x408000U, 
-	0x201008U, 0x408002U, 0x020140U, 0x408004U, 0x044080U, 0x080820U, 0x100024U, 0x082100U, 0x201010U, 0x010880U, 
-	0x100020U, 0x100021U, 0x100022U, 0x440040U, 0x040A00U, 0x408010U, 0x080440U, 0x124000U, 0x100028U, 0x200480U, 
-	0x01A000U, 0x001300U, 0x100014U, 0x060080U, 0x201020U, 0x004140U, 0x100010U, 0x100011U, 0x100012U, 0x080808U, 
-	0x006400U, 0x408020U, 0x030200U, 0x080804U, 0x100018U, 0x080802U, 0x080801U, 0x080800U, 0x100004U, 0x100005U, 
-	0x100006U, 0x008600U, 0x100000U, 0x100001U, 0x100002U, 0x100003U, 0x10000CU, 0x011040U, 0x400180U, 0x242000U, 
-	0x100008U, 0x100009U, 0x10000AU, 0x080810U, 0x052000U, 0x100C00U, 0x201040U, 0x004120U, 0x020108U, 0x081080U, 
-	0x008A00U, 0x440010U, 0x020104U, 0x408040U, 0x080410U, 0x002280U, 0x020100U, 0x020101U, 0x020102U, 0x310000U, 
-	0x00C080U, 0x220200U, 0x080408U, 0x440004U, 0x100060U, 0x440002U, 0x440001U, 0x440000U, 0x080402U, 0x011020U, 
-	0x080400U, 0x080401U, 0x020110U, 0x006800U, 0x080404U, 0x440008U, 0x480200U, 0x004102U, 0x004101U, 0x004100U, 
-	0x100050U, 0x20A000U, 0x010480U, 0x004104U, 0x200880U, 0x011010U, 0x148000U, 0x004108U, 0x020120U, 0x040600U, 
-	0x403000U, 0x080840U, 0x100044U, 0x011008U, 0x022800U, 0x004110U, 0x100040U, 0x100041U, 0x100042U, 0x440020U, 
-	0x011001U, 0x011000U, 0x080420U, 0x011002U, 0x100048U, 0x011004U, 0x204200U, 0x028080U};
+	0x0000000U, 0x1000001U, 0x1000002U, 0x2000003U, 0x1000004U, 0x2000005U, 0x2000006U, 0x3000007U, 0x1000008U, 0x2000009U, 
+	0x200000AU, 0x300000BU, 0x200000CU, 0x300000DU, 0x300000EU, 0x3024020U, 0x1000010U, 0x2000011U, 0x2000012U, 0x3000013U, 
+	0x2000014U, 0x3000015U, 0x3000016U, 0x3412000U, 0x2000018U, 0x3000019U, 0x300001AU, 0x3180800U, 0x300001CU, 0x3200300U, 
+	0x3048040U, 0x3001480U, 0x1000020U, 0x2000021U, 0x2000022U, 0x3000023U, 0x2000024U, 0x3000025U, 0x3000026U, 0x3024008U, 
+	0x2000028U, 0x3000029U, 0x300002AU, 0x3024004U, 0x300002CU, 0x3024002U, 0x3024001U, 0x2024000U, 0x2000030U, 0x3000031U, 
+	0x3000032U, 0x3008180U, 0x3000034U, 0x3000C40U, 0x3301000U, 0x30C0200U, 0x3000038U, 0x3043000U, 0x3400600U, 0x3210040U, 
+	0x3090080U, 0x3508000U, 0x3002900U, 0x3024010U, 0x1000040U, 0x2000041U, 0x2000042U, 0x3000043U, 0x2000044U, 0x3000045U, 
+	0x3000046U, 0x3280080U, 0x2000048U, 0x3000049U, 0x300004AU, 0x3002500U, 0x300004CU, 0x3111000U, 0x3048010U, 0x3400A00U, 
+	0x2000050U, 0x3000051U, 0x3000052U, 0x3021200U, 0x3000054U, 0x3000C20U, 0x3048008U, 0x3104100U, 0x3000058U, 0x3404080U, 
+	0x3048004U, 0x3210020U, 0x3048002U, 0x30A2000U, 0x2048000U, 0x3048001U, 0x2000060U, 0x3000061U, 0x3000062U, 0x3540000U, 
+	0x3000064U, 0x3000C10U, 0x3010300U, 0x300B000U, 0x3000068U, 0x3088200U, 0x3001880U, 0x3210010U, 0x3602000U, 0x3040180U, 
+	0x3180400U, 0x3024040U, 0x3000070U, 0x3000C04U, 0x3086000U, 0x3210008U, 0x3000C01U, 0x2000C00U, 0x3420080U, 0x3000C02U, 
+	0x3120100U, 0x3210002U, 0x3210001U, 0x2210000U, 0x3005200U, 0x3000C08U, 0x3048020U, 0x3210004U, 0x1000080U, 0x2000081U, 
+	0x2000082U, 0x3000083U, 0x2000084U, 0x3000085U, 0x3000086U, 0x3280040U, 0x2000088U, 0x3000089U, 0x300008AU, 0x3050200U, 
+	0x300008CU, 0x300A800U, 0x3500100U, 0x3001410U, 0x2000090U, 0x3000091U, 0x3000092U, 0x3008120U, 0x3000094U, 0x3160000U, 
+	0x3004A00U, 0x3001408U, 0x3000098U, 0x3404040U, 0x3222000U, 0x3001404U, 0x3090020U, 0x3001402U, 0x3001401U, 0x2001400U, 
+	0x20000A0U, 0x30000A1U, 0x30000A2U, 0x3008110U, 0x30000A4U, 0x3401200U, 0x3042400U, 0x3110800U, 0x30000A8U, 0x3300400U, 
+	0x3001840U, 0x3482000U, 0x3090010U, 0x3040140U, 0x3208200U, 0x3024080U, 0x30000B0U, 0x3008102U, 0x3008101U, 0x2008100U, 
+	0x3090008U, 0x3206000U, 0x3420040U, 0x3008104U, 0x3090004U, 0x3020A00U, 0x3144000U, 0x3008108U, 0x2090000U, 0x3090001U, 
+	0x3090002U, 0x3001420U, 0x20000C0U, 0x30000C1U, 0x30000C2U, 0x3280004U, 0x30000C4U, 0x3280002U, 0x3280001U, 0x2280000U, 
+	0x30000C8U, 0x3404010U, 0x3001820U, 0x3128000U, 0x3020600U, 0x3040120U, 0x3016000U, 0x3280008U, 0x30000D0U, 0x3404008U, 
+	0x3110400U, 0x3042800U, 0x3003100U, 0x3018200U, 0x3420020U, 0x3280010U, 0x3404001U, 0x2404000U, 0x3080300U, 0x3404002U, 
+	0x3300800U, 0x3404004U, 0x3048080U, 0x3001440U, 0x30000E0U, 0x3032000U, 0x3001808U, 0x3004600U, 0x310C000U, 0x3040108U, 
+	0x3420010U, 0x3280020U, 0x3001802U, 0x3040104U, 0x2001800U, 0x3001801U, 0x3040101U, 0x2040100U, 0x3001804U, 0x3040102U, 
+	0x3240200U, 0x3181000U, 0x3420004U, 0x3008140U, 0x3420002U, 0x3000C80U, 0x2420000U, 0x3420001U, 0x300A400U, 0x3404020U, 
+	0x3001810U, 0x3210080U, 0x3090040U, 0x3040110U, 0x3420008U, 0x3102200U, 0x1000100U, 0x2000101U, 0x2000102U, 0x3000103U, 
+	0x2000104U, 0x3000105U, 0x3000106U, 0x3041800U, 0x2000108U, 0x3000109U, 0x300010AU, 0x3002440U, 0x300010CU, 0x3200210U, 
+	0x3500080U, 0x3098000U, 0x2000110U, 0x3000111U, 0x3000112U, 0x30080A0U, 0x3000114U, 0x3200208U, 0x30A0400U, 0x3104040U, 
+	0x3000118U, 0x3200204U, 0x3015000U, 0x3460000U, 0x3200201U, 0x2200200U, 0x3002820U, 0x3200202U, 0x2000120U, 0x3000121U, 
+	0x3000122U, 0x3008090U, 0x3000124U, 0x3182000U, 0x3010240U, 0x3600400U, 0x3000128U, 0x3410800U, 0x32C0000U, 0x3101200U, 
+	0x3009400U, 0x30400C0U, 0x3002810U, 0x3024100U, 0x3000130U, 0x3008082U, 0x3008081U, 0x2008080U, 0x3444000U, 0x3031000U, 
+	0x3002808U, 0x3008084U, 0x3120040U, 0x3084400U, 0x3002804U, 0x3008088U, 0x3002802U, 0x3200220U, 0x2002800U, 0x3002801U, 
+	0x2000140U, 0x3000141U, 0x3000142U, 0x3002408U, 0x3000144U, 0x3428000U, 0x3010220U, 0x3104010U, 0x3000148U, 0x3002402U, 
+	0x3002401U, 0x2002400U, 0x3084800U, 0x30400A0U, 0x3221000U, 0x3002404U, 0x3000150U, 0x30D0000U, 0x3600800U, 0x3104004U, 
+	0x3003080U, 0x3104002U, 0x3104001U, 0x2104000U, 0x3120020U, 0x3009800U, 0x3080280U, 0x3002410U, 0x3410400U, 0x3200240U, 
+	0x3048100U, 0x3104008U, 0x3000160U, 0x3205000U, 0x3010204U, 0x30A0800U, 0x3010202U, 0x3040088U, 0x2010200U, 0x3010201U, 
+	0x3120010U, 0x3040084U, 0x340C000U, 0x3002420U, 0x3040081U, 0x2040080U, 0x3010208U, 0x3040082U, 0x3120008U, 0x3402200U, 
+	0x3041400U, 0x30080C0U, 0x3288000U, 0x3000D00U, 0x3010210U, 0x3104020U, 0x2120000U, 0x3120001U, 0x3120002U, 0x3210100U, 
+	0x3120004U, 0x3040090U, 0x3002840U, 0x3481000U, 0x2000180U, 0x3000181U, 0x3000182U, 0x3008030U, 0x3000184U, 0x3014400U, 
+	0x3500008U, 0x3022200U, 0x3000188U, 0x30A1000U, 0x3500004U, 0x3204800U, 0x3500002U, 0x3040060U, 0x2500000U, 0x3500001U, 
+	0x3000190U, 0x3008022U, 0x3008021U, 0x2008020U, 0x3003040U, 0x3480800U, 0x3250000U, 0x3008024U, 0x3040C00U, 0x3112000U, 
+	0x3080240U, 0x3008028U, 0x302C000U, 0x3200280U, 0x3500010U, 0x3001500U, 0x30001A0U, 0x3008012U, 0x3008011U, 0x2008010U, 
+	0x3220800U, 0x3040048U, 0x3085000U, 0x3008014U, 0x3006200U, 0x3040044U, 0x3030400U, 0x3008018U, 0x3040041U, 0x2040040U, 
+	0x3500020U, 0x3040042U, 0x3008003U, 0x2008002U, 0x2008001U, 0x1008000U, 0x3100600U, 0x3008006U, 0x3008005U, 0x2008004U, 
+	0x3601000U, 0x300800AU, 0x3008009U, 0x2008008U, 0x3090100U, 0x3040050U, 0x3002880U, 0x300800CU, 0x30001C0U, 0x3100A00U, 
+	0x3064000U, 0x3411000U, 0x3003010U, 0x3040028U, 0x3008C00U, 0x3280100U, 0x3218000U, 0x3040024U, 0x3080210U, 0x3002480U, 
+	0x3040021U, 0x2040020U, 0x3500040U, 0x3040022U, 0x3003004U, 0x3220400U, 0x3080208U, 0x3008060U, 0x2003000U, 0x3003001U, 
+	0x3003002U, 0x3104080U, 0x3080202U, 0x3404100U, 0x2080200U, 0x3080201U, 0x3003008U, 0x3040030U, 0x3080204U, 0x3030800U, 
+	0x3480400U, 0x304000CU, 0x3302000U, 0x3008050U, 0x3040009U, 0x2040008U, 0x3010280U, 0x304000AU, 0x3040005U, 0x2040004U, 
+	0x3001900U, 0x3040006U, 0x2040001U, 0x1040000U, 0x3040003U, 0x2040002U, 0x3014800U, 0x3008042U, 0x3008041U, 0x2008040U, 
+	0x3003020U, 0x3040018U, 0x3420100U, 0x3008044U, 0x3120080U, 0x3040014U, 0x3080220U, 0x3008048U, 0x3040011U, 0x2040010U, 
+	0x3204400U, 0x3040012U, 0x1000200U, 0x2000201U, 0x2000202U, 0x3000203U, 0x2000204U, 0x3000205U, 0x3000206U, 0x3108400U, 
+	0x2000208U, 0x3000209U, 0x300020AU, 0x3050080U, 0x300020CU, 0x3200110U, 0x3083000U, 0x3400840U, 0x2000210U, 0x3000211U, 
+	0x3000212U, 0x3021040U, 0x3000214U, 0x3200108U, 0x3004880U, 0x30C0020U, 0x3000218U, 0x3200104U, 0x3400420U, 0x300E000U, 
+	0x3200101U, 0x2200100U, 0x3130000U, 0x3200102U, 0x2000220U, 0x3000221U, 0x3000222U, 0x3202800U, 0x3000224U, 0x3401080U, 
+	0x3010140U, 0x30C0010U, 0x3000228U, 0x3088040U, 0x3400410U, 0x3101100U, 0x3140800U, 0x3012400U, 0x3208080U, 0x3024200U, 
+	0x3000230U, 0x3114000U, 0x3400408U, 0x30C0004U, 0x302A000U, 0x30C0002U, 0x30C0001U, 0x20C0000U, 0x3400402U, 0x3020880U, 
+	0x2400400U, 0x3400401U, 0x3005040U, 0x3200120U, 0x3400404U, 0x30C0008U, 0x2000240U, 0x3000241U, 0x3000242U, 0x3021010U, 
+	0x3000244U, 0x3046000U, 0x3010120U, 0x3400808U, 0x3000248U, 0x3088020U, 0x3304000U, 0x3400804U, 0x3020480U, 0x3400802U, 
+	0x3400801U, 0x2400800U, 0x3000250U, 0x3021002U, 0x3021001U, 0x2021000U, 0x3580000U, 0x3018080U, 0x3202400U, 0x3021004U, 
+	0x3012800U, 0x3140400U, 0x3080180U, 0x3021008U, 0x3005020U, 0x3200140U, 0x3048200U, 0x3400810U, 0x3000260U, 0x3088008U, 
+	0x3010104U, 0x3004480U, 0x3010102U, 0x3320000U, 0x2010100U, 0x3010101U, 0x3088001U, 0x2088000U, 0x3062000U, 0x3088002U, 
+	0x3005010U, 0x3088004U, 0x3010108U, 0x3400820U, 0x3240080U, 0x3402100U, 0x3108800U, 0x3021020U, 0x3005008U, 0x3000E00U, 
+	0x3010110U, 0x30C0040U, 0x3005004U, 0x3088010U, 0x3400440U, 0x3210200U, 0x2005000U, 0x3005001U, 0x3005002U, 0x3102080U, 
+	0x2000280U, 0x3000281U, 0x3000282U, 0x3050008U, 0x3000284U, 0x3401020U, 0x3004810U, 0x3022100U, 0x3000288U, 0x3050002U, 
+	0x3050001U, 0x2050000U, 0x3020440U, 0x3184000U, 0x3208020U, 0x3050004U, 0x3000290U, 0x3082400U, 0x3004804U, 0x3700000U, 
+	0x3004802U, 0x3018040U, 0x2004800U, 0x3004801U, 0x3109000U, 0x3020820U, 0x3080140U, 0x3050010U, 0x3442000U, 0x3200180U, 
+	0x3004808U, 0x3001600U, 0x30002A0U, 0x3401004U, 0x31A0000U, 0x3004440U, 0x3401001U, 0x2401000U, 0x3208008U, 0x3401002U, 
+	0x3006100U, 0x3020810U, 0x3208004U, 0x3050020U, 0x3208002U, 0x3401008U, 0x2208000U, 0x3208001U, 0x3240040U, 0x3020808U, 
+	0x3013000U, 0x3008300U, 0x3100500U, 0x3401010U, 0x3004820U, 0x30C0080U, 0x3020801U, 0x2020800U, 0x3400480U, 0x3020802U, 
+	0x3090200U, 0x3020804U, 0x3208010U, 0x3102040U, 0x30002C0U, 0x3100900U, 0x340A000U, 0x3004420U, 0x3020408U, 0x3018010U, 
+	0x3141000U, 0x3280200U, 0x3020404U, 0x3203000U, 0x3080110U, 0x3050040U, 0x2020400U, 0x3020401U, 0x3020402U, 0x3400880U, 
+	0x3240020U, 0x3018004U, 0x3080108U, 0x3021080U, 0x3018001U, 0x2018000U, 0x3004840U, 0x3018002U, 0x3080102U, 0x3404200U, 
+	0x2080100U, 0x3080101U, 0x3020410U, 0x3018008U, 0x3080104U, 0x3102020U, 0x3240010U, 0x3004402U, 0x3004401U, 0x2004400U, 
+	0x3082800U, 0x3401040U, 0x3010180U, 0x3004404U, 0x3510000U, 0x3088080U, 0x3001A00U, 0x3004408U, 0x3020420U, 0x3040300U, 
+	0x3208040U, 0x3102010U, 0x2240000U, 0x3240001U, 0x3240002U, 0x3004410U, 0x3240004U, 0x3018020U, 0x3420200U, 0x3102008U, 
+	0x3240008U, 0x3020840U, 0x3080120U, 0x3102004U, 0x3005080U, 0x3102002U, 0x3102001U, 0x2102000U, 0x2000300U, 0x3000301U, 
+	0x3000302U, 0x3484000U, 0x3000304U, 0x3200018U, 0x3010060U, 0x3022080U, 0x3000308U, 0x3200014U, 0x3028800U, 0x3101020U, 
+	0x3200011U, 0x2200010U, 0x3044400U, 0x3200012U, 0x3000310U, 0x320000CU, 0x3142000U, 0x3010C00U, 0x3200009U, 0x2200008U, 
+	0x3409000U, 0x320000AU, 0x3200005U, 0x2200004U, 0x30800C0U, 0x3200006U, 0x2200001U, 0x1200000U, 0x3200003U, 0x2200002U, 
+	0x3000320U, 0x3060400U, 0x3010044U, 0x3101008U, 0x3010042U, 0x300C800U, 0x2010040U, 0x3010041U, 0x3006080U, 0x3101002U, 
+	0x3101001U, 0x2101000U, 0x34A0000U, 0x3200030U, 0x3010048U, 0x3101004U, 0x3081800U, 0x3402040U, 0x3224000U, 0x3008280U, 
+	0x3100480U, 0x3200028U, 0x3010050U, 0x30C0100U, 0x3058000U, 0x3200024U, 0x3400500U, 0x3101010U, 0x3200021U, 0x2200020U, 
+	0x3002A00U, 0x3200022U, 0x3000340U, 0x3100880U, 0x3010024U, 0x3248000U, 0x3010022U, 0x3081400U, 0x2010020U, 0x3010021U, 
+	0x3441000U, 0x3034000U, 0x3080090U, 0x3002600U, 0x310A000U, 0x3200050U, 0x3010028U, 0x3400900U, 0x300C400U, 0x3402020U, 
+	0x3080088U, 0x3021100U, 0x3060800U, 0x3200048U, 0x3010030U, 0x3104200U, 0x3080082U, 0x3200044U, 0x2080080U, 0x3080081U, 
+	0x3200041U, 0x2200040U, 0x3080084U, 0x3200042U, 0x3010006U, 0x3402010U, 0x2010004U, 0x3010005U, 0x2010002U, 0x3010003U, 
+	0x1010000U, 0x2010001U, 0x3200C00U, 0x3088100U, 0x301000CU, 0x3101040U, 0x301000AU, 0x3040280U, 0x2010008U, 0x3010009U, 
+	0x3402001U, 0x2402000U, 0x3010014U, 0x3402002U, 0x3010012U, 0x3402004U, 0x2010010U, 0x3010011U, 0x3120200U, 0x3402008U, 
+	0x30800A0U, 0x3044800U, 0x3005100U, 0x3200060U, 0x3010018U, 0x3028400U, 0x3000380U, 0x3100840U, 0x3201400U, 0x3022004U, 
+	0x30C8000U, 0x3022002U, 0x3022001U, 0x2022000U, 0x3006020U, 0x3408400U, 0x3080050U, 0x3050100U, 0x3011800U, 0x3200090U, 
+	0x3500200U, 0x3022008U, 0x3430000U, 0x3045000U, 0x3080048U, 0x3008220U, 0x3100420U, 0x3200088U, 0x3004900U, 0x3022010U, 
+	0x3080042U, 0x3200084U, 0x2080040U, 0x3080041U, 0x3200081U, 0x2200080U, 0x3080044U, 0x3200082U, 0x3006008U, 0x3290000U, 
+	0x3440800U, 0x3008210U, 0x3100410U, 0x3401100U, 0x30100C0U, 0x3022020U, 0x2006000U, 0x3006001U, 0x3006002U, 0x3101080U, 
+	0x3006004U, 0x3040240U, 0x3208100U, 0x3080C00U, 0x3100404U, 0x3008202U, 0x3008201U, 0x2008200U, 0x2100400U, 0x3100401U, 
+	0x3100402U, 0x3008204U, 0x3006010U, 0x3020900U, 0x3080060U, 0x3008208U, 0x3100408U, 0x32000A0U, 0x3061000U, 0x3414000U, 
+	0x3100801U, 0x2100800U, 0x3080018U, 0x3100802U, 0x3604000U, 0x3100804U, 0x30100A0U, 0x3022040U, 0x3080012U, 0x3100808U, 
+	0x2080010U, 0x3080011U, 0x3020500U, 0x3040220U, 0x3080014U, 0x300D000U, 0x308000AU, 0x3100810U, 0x2080008U, 0x3080009U, 
+	0x3003200U, 0x3018100U, 0x308000CU, 0x3440400U, 0x2080002U, 0x3080003U, 0x1080000U, 0x2080001U, 0x3080006U, 0x32000C0U, 
+	0x2080004U, 0x3080005U, 0x3029000U, 0x3100820U, 0x3010084U, 0x3004500U, 0x3010082U, 0x3040208U, 0x2010080U, 0x3010081U, 
+	0x3006040U, 0x3040204U, 0x3080030U, 0x3620000U, 0x3040201U, 0x2040200U, 0x3010088U, 0x3040202U, 0x3240100U, 0x3402080U, 
+	0x3080028U, 0x3008240U, 0x3100440U, 0x30A4000U, 0x3010090U, 0x3201800U, 0x3080022U, 0x3011400U, 0x2080020U, 0x3080021U, 
+	0x3408800U, 0x3040210U, 0x3080024U, 0x3102100U, 0x1000400U, 0x2000401U, 0x2000402U, 0x3000403U, 0x2000404U, 0x3000405U, 
+	0x3000406U, 0x3108200U, 0x2000408U, 0x3000409U, 0x300040AU, 0x3002140U, 0x300040CU, 0x34C0000U, 0x3210800U, 0x3001090U, 
+	0x2000410U, 0x3000411U, 0x3000412U, 0x3244000U, 0x3000414U, 0x3000860U, 0x30A0100U, 0x3001088U, 0x3000418U, 0x3038000U, 
+	0x3400220U, 0x3001084U, 0x3106000U, 0x3001082U, 0x3001081U, 0x2001080U, 0x2000420U, 0x3000421U, 0x3000422U, 0x3091000U, 
+	0x3000424U, 0x3000850U, 0x3042080U, 0x3600100U, 0x3000428U, 0x3300080U, 0x3400210U, 0x3048800U, 0x3009100U, 0x3012200U, 
+	0x3180040U, 0x3024400U, 0x3000430U, 0x3000844U, 0x3400208U, 0x3122000U, 0x3000841U, 0x2000840U, 0x301C000U, 0x3000842U, 
+	0x3400202U, 0x3084100U, 0x2400200U, 0x3400201U, 0x3260000U, 0x3000848U, 0x3400204U, 0x30010A0U, 0x2000440U, 0x3000441U, 
+	0x3000442U, 0x3002108U, 0x3000444U, 0x3000830U, 0x3405000U, 0x3070000U, 0x3000448U, 0x3002102U, 0x3002101U, 0x2002100U, 
+	0x3020280U, 0x320C000U, 0x3180020U, 0x3002104U, 0x3000450U, 0x3000824U, 0x3110080U, 0x3488000U, 0x3000821U, 0x2000820U, 
+	0x3202200U, 0x3000822U, 0x3281000U, 0x3140200U, 0x3024800U, 0x3002110U, 0x3410100U, 0x3000828U, 0x3048400U, 0x30010C0U, 
+	0x3000460U, 0x3000814U, 0x3228000U, 0x3004280U, 0x3000811U, 0x2000810U, 0x3180008U, 0x3000812U, 0x3054000U, 0x3421000U, 
+	0x3180004U, 0x3002120U, 0x3180002U, 0x3000818U, 0x2180000U, 0x3180001U, 0x3000805U, 0x2000804U, 0x3041100U, 0x3000806U, 
+	0x2000801U, 0x1000800U, 0x3000803U, 0x2000802U, 0x300A080U, 0x300080CU, 0x3400240U, 0x3210400U, 0x3000809U, 0x2000808U, 
+	0x3180010U, 0x300080AU, 0x2000480U, 0x3000481U, 0x3000482U, 0x3420800U, 0x3000484U, 0x3014100U, 0x3042020U, 0x3001018U, 
+	0x3000488U, 0x3300020U, 0x308C000U, 0x3001014U, 0x3020240U, 0x3001012U, 0x3001011U, 0x2001010U, 0x3000490U, 0x3082200U, 
+	0x3110040U, 0x300100CU, 0x3608000U, 0x300100AU, 0x3001009U, 0x2001008U, 0x3040900U, 0x3001006U, 0x3001005U, 0x2001004U, 
+	0x3001003U, 0x2001002U, 0x2001001U, 0x1001000U, 0x30004A0U, 0x3300008U, 0x3042004U, 0x3004240U, 0x3042002U, 0x30A8000U, 
+	0x2042000U, 0x3042001U, 0x3300001U, 0x2300000U, 0x3030100U, 0x3300002U, 0x3404800U, 0x3300004U, 0x3042008U, 0x3001030U, 
+	0x3025000U, 0x3450000U, 0x3280800U, 0x3008500U, 0x3100300U, 0x30008C0U, 0x3042010U, 0x3001028U, 0x300A040U, 0x3300010U, 
+	0x3400280U, 0x3001024U, 0x3090400U, 0x3001022U, 0x3001021U, 0x2001020U, 0x30004C0U, 0x3049000U, 0x3110010U, 0x3004220U, 
+	0x3020208U, 0x3502000U, 0x3008900U, 0x3280400U, 0x3020204U, 0x3090800U, 0x3640000U, 0x3002180U, 0x2020200U, 0x3020201U, 
+	0x3020202U, 0x3001050U, 0x3110002U, 0x3220100U, 0x2110000U, 0x3110001U, 0x30C4000U, 0x30008A0U, 0x3110004U, 0x3001048U, 
+	0x300A020U, 0x3404400U, 0x3110008U, 0x3001044U, 0x3020210U, 0x3001042U, 0x3001041U, 0x2001040U, 0x3480100U, 0x3004202U, 
+	0x3004201U, 0x2004200U, 0x3211000U, 0x3000890U, 0x3042040U, 0x3004204U, 0x300A010U, 0x3300040U, 0x3001C00U, 0x3004208U, 
+	0x3020220U, 0x3040500U, 0x3180080U, 0x3418000U, 0x300A008U, 0x3000884U, 0x3110020U, 0x3004210U, 0x3000881U, 0x2000880U, 
+	0x3420400U, 0x3000882U, 0x200A000U, 0x300A001U, 0x300A002U, 0x30E0000U, 0x300A004U, 0x3000888U, 0x3204100U, 0x3001060U, 
+	0x2000500U, 0x3000501U, 0x3000502U, 0x3002048U, 0x3000504U, 0x3014080U, 0x30A0010U, 0x3600020U, 0x3000508U, 0x3002042U, 
+	0x3002041U, 0x2002040U, 0x3009020U, 0x3120800U, 0x3044200U, 0x3002044U, 0x3000510U, 0x3501000U, 0x30A0004U, 0x3010A00U, 
+	0x30A0002U, 0x304A000U, 0x20A0000U, 0x30A0001U, 0x3040880U, 0x3084020U, 0x3308000U, 0x3002050U, 0x3410040U, 0x3200600U, 
+	0x30A0008U, 0x3001180U, 0x3000520U, 0x3060200U, 0x3104800U, 0x3600004U, 0x3009008U, 0x3600002U, 0x3600001U, 0x2600000U, 
+	0x3009004U, 0x3084010U, 0x3030080U, 0x3002060U, 0x2009000U, 0x3009001U, 0x3009002U, 0x3600008U, 0x3212000U, 0x3084008U, 
+	0x3041040U, 0x3008480U, 0x3100280U, 0x3000940U, 0x30A0020U, 0x3600010U, 0x3084001U, 0x2084000U, 0x3400300U, 0x3084002U, 
+	0x3009010U, 0x3084004U, 0x3002C00U, 0x3150000U, 0x3000540U, 0x300200AU, 0x3002009U, 0x2002008U, 0x3340000U, 0x3081200U, 
+	0x3008880U, 0x300200CU, 0x3002003U, 0x2002002U, 0x2002001U, 0x1002000U, 0x3410010U, 0x3002006U, 0x3002005U, 0x2002004U, 
+	0x300C200U, 0x3220080U, 0x3041020U, 0x3002018U, 0x3410008U, 0x3000920U, 0x30A0040U, 0x3104400U, 0x3410004U, 0x3002012U, 
+	0x3002011U, 0x2002010U, 0x2410000U, 0x3410001U, 0x3410002U, 0x3002014U, 0x3480080U, 0x3118000U, 0x3041010U, 0x3002028U, 
+	0x3026000U, 0x3000910U, 0x3010600U, 0x3600040U, 0x3200A00U, 0x3002022U, 0x3002021U, 0x2002020U, 0x3009040U, 0x3040480U, 
+	0x3180100U, 0x3002024U, 0x3041002U, 0x3000904U, 0x2041000U, 0x3041001U, 0x3000901U, 0x2000900U, 0x3041004U, 0x3000902U, 
+	0x3120400U, 0x3084040U, 0x3041008U, 0x3002030U, 0x3410020U, 0x3000908U, 0x3204080U, 0x3028200U, 0x3000580U, 0x3014004U, 
+	0x3201200U, 0x31C0000U, 0x3014001U, 0x2014000U, 0x3008840U, 0x3014002U, 0x3040810U, 0x3408200U, 0x3030020U, 0x30020C0U, 
+	0x3282000U, 0x3014008U, 0x3500400U, 0x3001110U, 0x3040808U, 0x3220040U, 0x3406000U, 0x3008420U, 0x3100220U, 0x3014010U, 
+	0x30A0080U, 0x3001108U, 0x2040800U, 0x3040801U, 0x3040802U, 0x3001104U, 0x3040804U, 0x3001102U, 0x3001101U, 0x2001100U, 
+	0x3480040U, 0x3003800U, 0x3030008U, 0x3008410U, 0x3100210U, 0x3014020U, 0x3042100U, 0x3600080U, 0x3030002U, 0x3300100U, 
+	0x2030000U, 0x3030001U, 0x3009080U, 0x3040440U, 0x3030004U, 0x3080A00U, 0x3100204U, 0x3008402U, 0x3008401U, 0x2008400U, 
+	0x2100200U, 0x3100201U, 0x3100202U, 0x3008404U, 0x3040820U, 0x3084080U, 0x3030010U, 0x3008408U, 0x3100208U, 0x3422000U, 
+	0x3204040U, 0x3001120U, 0x3480020U, 0x3220010U, 0x3008804U, 0x3002088U, 0x3008802U, 0x3014040U, 0x2008800U, 0x3008801U, 
+	0x3105000U, 0x3002082U, 0x3002081U, 0x2002080U, 0x3020300U, 0x3040420U, 0x3008808U, 0x3002084U, 0x3220001U, 0x2220000U, 
+	0x3110100U, 0x3220002U, 0x3003400U, 0x3220004U, 0x3008810U, 0x3440200U, 0x3040840U, 0x3220008U, 0x3080600U, 0x3002090U, 
+	0x3410080U, 0x3188000U, 0x3204020U, 0x3001140U, 0x2480000U, 0x3480001U, 0x3480002U, 0x3004300U, 0x3480004U, 0x3040408U, 
+	0x3008820U, 0x3121000U, 0x3480008U, 0x3040404U, 0x3030040U, 0x30020A0U, 0x3040401U, 0x2040400U, 0x3204010U, 0x3040402U, 
+	0x3480010U, 0x3220020U, 0x3041080U, 0x3008440U, 0x3100240U, 0x3000980U, 0x3204008U, 0x3092000U, 0x300A100U, 0x3011200U, 
+	0x3204004U, 0x3500800U, 0x3204002U, 0x3040410U, 0x2204000U, 0x3204001U, 0x2000600U, 0x3000601U, 0x3000602U, 0x3108004U, 
+	0x3000604U, 0x3108002U, 0x3108001U, 0x2108000U, 0x3000608U, 0x3005800U, 0x3400030U, 0x32A0000U, 0x30200C0U, 0x3012020U, 
+	0x3044100U, 0x3108008U, 0x3000610U, 0x3082080U, 0x3400028U, 0x3010900U, 0x3051000U, 0x3424000U, 0x3202040U, 0x3108010U, 
+	0x3400022U, 0x3140040U, 0x2400020U, 0x3400021U, 0x3088800U, 0x3200500U, 0x3400024U, 0x3001280U, 0x3000620U, 0x3060100U, 
+	0x3400018U, 0x30040C0U, 0x3284000U, 0x3012008U, 0x3021800U, 0x3108020U, 0x3400012U, 0x3012004U, 0x2400010U, 0x3400011U, 
+	0x3012001U, 0x2012000U, 0x3400014U, 0x3012002U, 0x340000AU, 0x3209000U, 0x2400008U, 0x3400009U, 0x3100180U, 0x3000A40U, 
+	0x340000CU, 0x30C0400U, 0x2400002U, 0x3400003U, 0x1400000U, 0x2400001U, 0x3400006U, 0x3012010U, 0x2400004U, 0x3400005U, 
+	0x3000640U, 0x3610000U, 0x30C0800U, 0x30040A0U, 0x3020088U, 0x3081100U, 0x3202010U, 0x3108040U, 0x3020084U, 0x3140010U, 
+	0x3019000U, 0x3002300U, 0x2020080U, 0x3020081U, 0x3020082U, 0x3400C00U, 0x300C100U, 0x3140008U, 0x3202004U, 0x3021400U, 
+	0x3202002U, 0x3000A20U, 0x2202000U, 0x3202001U, 0x3140001U, 0x2140000U, 0x3400060U, 0x3140002U, 0x3020090U, 0x3140004U, 
+	0x3202008U, 0x3094000U, 0x3103000U, 0x3004082U, 0x3004081U, 0x2004080U, 0x3448000U, 0x3000A10U, 0x3010500U, 0x3004084U, 
+	0x3200900U, 0x3088400U, 0x3400050U, 0x3004088U, 0x30200A0U, 0x3012040U, 0x3180200U, 0x3241000U, 0x30B0000U, 0x3000A04U, 
+	0x3400048U, 0x3004090U, 0x3000A01U, 0x2000A00U, 0x3202020U, 0x3000A02U, 0x3400042U, 0x3140020U, 0x2400040U, 0x3400041U, 
+	0x3005400U, 0x3000A08U, 0x3400044U, 0x3028100U, 0x3000680U, 0x3082010U, 0x3201100U, 0x3004060U, 0x3020048U, 0x3240800U, 
+	0x3490000U, 0x3108080U, 0x3020044U, 0x3408100U, 0x3102800U, 0x3050400U, 0x2020040U, 0x3020041U, 0x3020042U, 0x3001210U, 
+	0x3082001U, 0x2082000U, 0x3068000U, 0x3082002U, 0x3100120U, 0x3082004U, 0x3004C00U, 0x3001208U, 0x3214000U, 0x3082008U, 
+	0x34000A0U, 0x3001204U, 0x3020050U, 0x3001202U, 0x3001201U, 0x2001200U, 0x3018800U, 0x3004042U, 0x3004041U, 0x2004040U, 
+	0x3100110U, 0x3401400U, 0x3042200U, 0x3004044U, 0x30C1000U, 0x3300200U, 0x3400090U, 0x3004048U, 0x3020060U, 0x3012080U, 
+	0x3208400U, 0x3080900U, 0x3100104U, 0x3082020U, 0x3400088U, 0x3004050U, 0x2100100U, 0x3100101U, 0x3100102U, 0x3230000U, 
+	0x3400082U, 0x3020C00U, 0x2400080U, 0x3400081U, 0x3100108U, 0x304C000U, 0x3400084U, 0x3001220U, 0x302000CU, 0x3004022U, 
+	0x3004021U, 0x2004020U, 0x2020008U, 0x3020009U, 0x302000AU, 0x3004024U, 0x2020004U, 0x3020005U, 0x3020006U, 0x3004028U, 
+	0x1020000U, 0x2020001U, 0x2020002U, 0x3020003U, 0x3401800U, 0x3082040U, 0x3110200U, 0x3004030U, 0x3020018U, 0x3018400U, 
+	0x3202080U, 0x3440100U, 0x3020014U, 0x3140080U, 0x3080500U, 0x3208800U, 0x2020010U, 0x3020011U, 0x3020012U, 0x3001240U, 
+	0x3004003U, 0x2004002U, 0x2004001U, 0x1004000U, 0x3020028U, 0x3004006U, 0x3004005U, 0x2004004U, 0x3020024U, 0x300400AU, 
+	0x3004009U, 0x2004008U, 0x2020020U, 0x3020021U, 0x3020022U, 0x300400CU, 0x3240400U, 0x3004012U, 0x3004011U, 0x2004010U, 
+	0x3100140U, 0x3000A80U, 0x3089000U, 0x3004014U, 0x300A200U, 0x3011100U, 0x34000C0U, 0x3004018U, 0x3020030U, 0x3680000U, 
+	0x3050800U, 0x3102400U, 0x3000700U, 0x3060020U, 0x3201080U, 0x3010810U, 0x3402800U, 0x3081040U, 0x3044008U, 0x3108100U, 
+	0x3190000U, 0x3408080U, 0x3044004U, 0x3002240U, 0x3044002U, 0x3200410U, 0x2044000U, 0x3044001U, 0x300C040U, 0x3010802U, 
+	0x3010801U, 0x2010800U, 0x31000A0U, 0x3200408U, 0x30A0200U, 0x3010804U, 0x3023000U, 0x3200404U, 0x3400120U, 0x3010808U, 
+	0x3200401U, 0x2200400U, 0x3044010U, 0x3200402U, 0x3060001U, 0x2060000U, 0x308A000U, 0x3060002U, 0x3100090U, 0x3060004U, 
+	0x3010440U, 0x3600200U, 0x3200840U, 0x3060008U, 0x3400110U, 0x3101400U, 0x3009200U, 0x3012100U, 0x3044020U, 0x3080880U, 
+	0x3100084U, 0x3060010U, 0x3400108U, 0x3010820U, 0x2100080U, 0x3100081U, 0x3100082U, 0x3007000U, 0x3400102U, 0x3084200U, 
+	0x2400100U, 0x3400101U, 0x3100088U, 0x3200420U, 0x3400104U, 0x3028040U, 0x300C010U, 0x3081004U, 0x3520000U, 0x3002208U, 
+	0x3081001U, 0x2081000U, 0x3010420U, 0x3081002U, 0x3200820U, 0x3002202U, 0x3002201U, 0x2002200U, 0x3020180U, 0x3081008U, 
+	0x3044040U, 0x3002204U, 0x200C000U, 0x300C001U, 0x300C002U, 0x3010840U, 0x300C004U, 0x3081010U, 0x3202100U, 0x3440080U, 
+	0x300C008U, 0x3140100U, 0x3080480U, 0x3002210U, 0x3410200U, 0x3200440U, 0x3101800U, 0x3028020U, 0x3200808U, 0x3060040U, 
+	0x3010404U, 0x3004180U, 0x3010402U, 0x3081020U, 0x2010400U, 0x3010401U, 0x2200800U, 0x3200801U, 0x3200802U, 0x3002220U, 
+	0x3200804U, 0x3504000U, 0x3010408U, 0x3028010U, 0x300C020U, 0x3402400U, 0x3041200U, 0x3380000U, 0x31000C0U, 0x3000B00U, 
+	0x3010410U, 0x3028008U, 0x3200810U, 0x3011080U, 0x3400140U, 0x3028004U, 0x30C2000U, 0x3028002U, 0x3028001U, 0x2028000U, 
+	0x3201002U, 0x3408008U, 0x2201000U, 0x3201001U, 0x3100030U, 0x3014200U, 0x3201004U, 0x3022400U, 0x3408001U, 0x2408000U, 
+	0x3201008U, 0x3408002U, 0x3020140U, 0x3408004U, 0x3044080U, 0x3080820U, 0x3100024U, 0x3082100U, 0x3201010U, 0x3010880U, 
+	0x2100020U, 0x3100021U, 0x3100022U, 0x3440040U, 0x3040A00U, 0x3408010U, 0x3080440U, 0x3124000U, 0x3100028U, 0x3200480U, 
+	0x301A000U, 0x3001300U, 0x3100014U, 0x3060080U, 0x3201020U, 0x3004140U, 0x2100010U, 0x3100011U, 0x3100012U, 0x3080808U, 
+	0x3006400U, 0x3408020U, 0x3030200U, 0x3080804U, 0x3100018U, 0x3080802U, 0x3080801U, 0x2080800U, 0x2100004U, 0x3100005U, 
+	0x3100006U, 0x3008600U, 0x1100000U, 0x2100001U, 0x2100002U, 0x3100003U, 0x310000CU, 0x3011040U, 0x3400180U, 0x3242000U, 
+	0x2100008U, 0x3100009U, 0x310000AU, 0x3080810U, 0x3052000U, 0x3100C00U, 0x3201040U, 0x3004120U, 0x3020108U, 0x3081080U, 
+	0x3008A00U, 0x3440010U, 0x3020104U, 0x3408040U, 0x3080410U, 0x3002280U, 0x2020100U, 0x3020101U, 0x3020102U, 0x3310000U, 
+	0x300C080U, 0x3220200U, 0x3080408U, 0x3440004U, 0x3100060U, 0x3440002U, 0x3440001U, 0x2440000U, 0x3080402U, 0x3011020U, 
+	0x2080400U, 0x3080401U, 0x3020110U, 0x3006800U, 0x3080404U, 0x3440008U, 0x3480200U, 0x3004102U, 0x3004101U, 0x2004100U, 
+	0x3100050U, 0x320A000U, 0x3010480U, 0x3004104U, 0x3200880U, 0x3011010U, 0x3148000U, 0x3004108U, 0x3020120U, 0x3040600U, 
+	0x3403000U, 0x3080840U, 0x3100044U, 0x3011008U, 0x3022800U, 0x3004110U, 0x2100040U, 0x3100041U, 0x3100042U, 0x3440020U, 
+	0x3011001U, 0x2011000U, 0x3080420U, 0x3011002U, 0x3100048U, 0x3011004U, 0x3204200U, 0x3028080U};
+#endif
+
+// The syndromes of bits 16 to 22, and of bits 8 to 15, of a (23,12) code word. The
+// syndrome is linear so it is the XOR of the syndromes of each byte, and bits 0 to 7
+// are below the generator polynomial and so are their own syndrome.
+static const uint16_t SYNDROME_TABLE_23127_HIGH[] = {
+	0x000U, 0x366U, 0x6CCU, 0x5AAU, 0x1EDU, 0x28BU, 0x721U, 0x447U, 0x3DAU, 0x0BCU,
+	0x516U, 0x670U, 0x237U, 0x151U, 0x4FBU, 0x79DU, 0x7B4U, 0x4D2U, 0x178U, 0x21EU,
+	0x659U, 0x53FU, 0x095U, 0x3F3U, 0x46EU, 0x708U, 0x2A2U, 0x1C4U, 0x583U, 0x6E5U,
+	0x34FU, 0x029U, 0x31DU, 0x07BU, 0x5D1U, 0x6B7U, 0x2F0U, 0x196U, 0x43CU, 0x75AU,
+	0x0C7U, 0x3A1U, 0x60BU, 0x56DU, 0x12AU, 0x24CU, 0x7E6U, 0x480U, 0x4A9U, 0x7CFU,
+	0x265U, 0x103U, 0x544U, 0x622U, 0x388U, 0x0EEU, 0x773U, 0x415U, 0x1BFU, 0x2D9U,
+	0x69EU, 0x5F8U, 0x052U, 0x334U, 0x63AU, 0x55CU, 0x0F6U, 0x390U, 0x7D7U, 0x4B1U,
+	0x11BU, 0x27DU, 0x5E0U, 0x686U, 0x32CU, 0x04AU, 0x40DU, 0x76BU, 0x2C1U, 0x1A7U,
+	0x18EU, 0x2E8U, 0x742U, 0x424U, 0x063U, 0x305U, 0x6AFU, 0x5C9U, 0x254U, 0x132U,
+	0x498U, 0x7FEU, 0x3B9U, 0x0DFU, 0x575U, 0x613U, 0x527U, 0x641U, 0x3EBU, 0x08DU,
+	0x4CAU, 0x7ACU, 0x206U, 0x160U, 0x6FDU, 0x59BU, 0x031U, 0x357U, 0x710U, 0x476U,
+	0x1DCU, 0x2BAU, 0x293U, 0x1F5U, 0x45FU, 0x739U, 0x37EU, 0x018U, 0x5B2U, 0x6D4U,
+	0x149U, 0x22FU, 0x785U, 0x4E3U, 0x0A4U, 0x3C2U, 0x668U, 0x50EU};
+
+static const uint16_t SYNDROME_TABLE_23127_MID[] = {
+	0x000U, 0x100U, 0x200U, 0x300U, 0x400U, 0x500U, 0x600U, 0x700U, 0x475U, 0x575U,
+	0x675U, 0x775U, 0x075U, 0x175U, 0x275U, 0x375U, 0x49FU, 0x59FU, 0x69FU, 0x79FU,
+	0x09FU, 0x19FU, 0x29FU, 0x39FU, 0x0EAU, 0x1EAU, 0x2EAU, 0x3EAU, 0x4EAU, 0x5EAU,
+	0x6EAU, 0x7EAU, 0x54BU, 0x44BU, 0x74BU, 0x64BU, 0x14BU, 0x04BU, 0x34BU, 0x24BU,
+	0x13EU, 0x03EU, 0x33EU, 0x23EU, 0x53EU, 0x43EU, 0x73EU, 0x63EU, 0x1D4U, 0x0D4U,
+	0x3D4U, 0x2D4U, 0x5D4U, 0x4D4U, 0x7D4U, 0x6D4U, 0x5A1U, 0x4A1U, 0x7A1U, 0x6A1U,
+	0x1A1U, 0x0A1U, 0x3A1U, 0x2A1U, 0x6E3U, 0x7E3U, 0x4E3U, 0x5E3U, 0x2E3U, 0x3E3U,
+	0x0E3U, 0x1E3U, 0x296U, 0x396U, 0x096U, 0x196U, 0x696U, 0x796U, 0x496U, 0x596U,
+	0x27CU, 0x37CU, 0x07CU, 0x17CU, 0x67CU, 0x77CU, 0x47CU, 0x57CU, 0x609U, 0x709U,
+	0x409U, 0x509U, 0x209U, 0x309U, 0x009U, 0x109U, 0x3A8U, 0x2A8U, 0x1A8U, 0x0A8U,
+	0x7A8U, 0x6A8U, 0x5A8U, 0x4A8U, 0x7DDU, 0x6DDU, 0x5DDU, 0x4DDU, 0x3DDU, 0x2DDU,
+	0x1DDU, 0x0DDU, 0x737U, 0x637U, 0x537U, 0x437U, 0x337U, 0x237U, 0x137U, 0x037U,
+	0x342U, 0x242U, 0x142U, 0x042U, 0x742U, 0x642U, 0x542U, 0x442U, 0x1B3U, 0x0B3U,
+	0x3B3U, 0x2B3U, 0x5B3U, 0x4B3U, 0x7B3U, 0x6B3U, 0x5C6U, 0x4C6U, 0x7C6U, 0x6C6U,
+	0x1C6U, 0x0C6U, 0x3C6U, 0x2C6U, 0x52CU, 0x42CU, 0x72CU, 0x62CU, 0x12CU, 0x02CU,
+	0x32CU, 0x22CU, 0x159U, 0x059U, 0x359U, 0x259U, 0x559U, 0x459U, 0x759U, 0x659U,
+	0x4F8U, 0x5F8U, 0x6F8U, 0x7F8U, 0x0F8U, 0x1F8U, 0x2F8U, 0x3F8U, 0x08DU, 0x18DU,
+	0x28DU, 0x38DU, 0x48DU, 0x58DU, 0x68DU, 0x78DU, 0x067U, 0x167U, 0x267U, 0x367U,
+	0x467U, 0x567U, 0x667U, 0x767U, 0x412U, 0x512U, 0x612U, 0x712U, 0x012U, 0x112U,
+	0x212U, 0x312U, 0x750U, 0x650U, 0x550U, 0x450U, 0x350U, 0x250U, 0x150U, 0x050U,
+	0x325U, 0x225U, 0x125U, 0x025U, 0x725U, 0x625U, 0x525U, 0x425U, 0x3CFU, 0x2CFU,
+	0x1CFU, 0x0CFU, 0x7CFU, 0x6CFU, 0x5CFU, 0x4CFU, 0x7BAU, 0x6BAU, 0x5BAU, 0x4BAU,
+	0x3BAU, 0x2BAU, 0x1BAU, 0x0BAU, 0x21BU, 0x31BU, 0x01BU, 0x11BU, 0x61BU, 0x71BU,
+	0x41BU, 0x51BU, 0x66EU, 0x76EU, 0x46EU, 0x56EU, 0x26EU, 0x36EU, 0x06EU, 0x16EU,
+	0x684U, 0x784U, 0x484U, 0x584U, 0x284U, 0x384U, 0x084U, 0x184U, 0x2F1U, 0x3F1U,
+	0x0F1U, 0x1F1U, 0x6F1U, 0x7F1U, 0x4F1U, 0x5F1U};
 
 #define X22             0x00400000   /* vector representation of X^{22} */
 #define X11             0x00000800   /* vector representation of X^{11} */
@@ -1069,20 +1121,113 @@ static unsigned int get_syndrome_23127(unsigned int pattern)
 	return pattern;
 }
 
+static inline unsigned int get_syndrome_23127_sliced(unsigned int pattern)
+{
+	return SYNDROME_TABLE_23127_HIGH[(pattern >> 16) & 0x7FU] ^ SYNDROME_TABLE_23127_MID[(pattern >> 8) & 0xFFU] ^ (pattern & 0xFFU);
+}
+
+// The optional direct decoding table, the data in the bottom 12 bits and the number of errors above it
+const unsigned int DIRECT_TABLE_23127_LENGTH = 1U << 23;
+
+static uint16_t* direct_table_23127 = NULL;
+
+// A decoding table entry has the error pattern in the bottom 23 bits and its weight above them
+const unsigned int ERROR_PATTERN_MASK  = 0x7FFFFFU;
+const unsigned int ERROR_WEIGHT_SHIFT  = 24U;
+
+#if defined(SMALL_TABLES)
+// The error pattern of each syndrome, packed into three bytes, with the
+// weights two bits each alongside, and built on first use from the 2048
+// patterns of up to three errors
+class CDecodingTable {
+public:
+	CDecodingTable()
+	{
+		set(0U, 0U);
+
+		for (unsigned int i = 0U; i < 23U; i++) {
+			set(1U << i, 1U);
+
+			for (unsigned int j = i + 1U; j < 23U; j++) {
+				set((1U << i) | (1U << j), 2U);
+
+				for (unsigned int k = j + 1U; k < 23U; k++)
+					set((1U << i) | (1U << j) | (1U << k), 3U);
+			}
+		}
+	}
+
+	unsigned int get(unsigned int syndrome) const
+	{
+		const unsigned char* p = m_patterns + syndrome * 3U;
+		unsigned int weight = (m_weights[syndrome / 4U] >> ((syndrome % 4U) * 2U)) & 0x03U;
+
+		return (weight << ERROR_WEIGHT_SHIFT) | (p[0U] << 16) | (p[1U] << 8) | p[2U];
+	}
+
+private:
+	unsigned char m_patterns[2048U * 3U];
+	unsigned char m_weights[2048U / 4U];
+
+	void set(unsigned int pattern, unsigned int weight)
+	{
+		unsigned int syndrome = ::get_syndrome_23127_sliced(pattern);
+
+		unsigned char* p = m_patterns + syndrome * 3U;
+		p[0U] = (pattern >> 16) & 0xFFU;
+		p[1U] = (pattern >> 8) & 0xFFU;
+		p[2U] = (pattern >> 0) & 0xFFU;
+
+		m_weights[syndrome / 4U] &= ~(0x03U << ((syndrome % 4U) * 2U));
+		m_weights[syndrome / 4U] |= weight << ((syndrome % 4U) * 2U);
+	}
+};
+
+static inline unsigned int get_error_entry_23127(unsigned int syndrome)
+{
+	static const CDecodingTable table;
+
+	return table.get(syndrome);
+}
+
+unsigned int CGolay24128::encode23127(unsigned int data)
+{
+	unsigned int code = (data & 0xFFFU) << 11;
+
+	return (code | ::get_syndrome_23127_sliced(code)) << 1;
+}
+
+unsigned int CGolay24128::encode24128(unsigned int data)
+{
+	unsigned int code = encode23127(data);
+
+	// The extended parity bit makes the weight of the codeword even
+	return code | CBitUtils::parity(code);
+}
+#else
+static inline unsigned int get_error_entry_23127(unsigned int syndrome)
+{
+	return DECODING_TABLE_23127[syndrome];
+}
+
 unsigned int CGolay24128::encode23127(unsigned int data)
 {
-    return ENCODING_TABLE_23127[data];
+	return ENCODING_TABLE_23127[data];
 }
 
 unsigned int CGolay24128::encode24128(unsigned int data)
 {
-    return ENCODING_TABLE_24128[data];
+	return ENCODING_TABLE_24128[data];
 }
+#endif
 
 unsigned int CGolay24128::decode23127(unsigned int code)
 {
-	unsigned int syndrome = ::get_syndrome_23127(code);
-	unsigned int error_pattern = DECODING_TABLE_23127[syndrome];
+	if (direct_table_23127 != NULL)
+		return direct_table_23127[code] & 0xFFFU;
+
+	unsigned int syndrome = ::get_syndrome_23127_sliced(code);
+	unsigned int error_pattern = ::get_error_entry_23127(syndrome) & ERROR_PATTERN_MASK;
 
 	code ^= error_pattern;
 
@@ -1106,3 +1251,113 @@ unsigned int CGolay24128::decode24128(unsigned char* bytes)
 
 	return decode23127(code >> 1);
 }
+
+// The number of errors comes with the error pattern from the table
+unsigned int CGolay24128::decode23127(unsigned int code, unsigned int& errors)
+{
+	if (direct_table_23127 != NULL) {
+		unsigned int entry = direct_table_23127[code];
+		errors = entry >> 12;
+		return entry & 0xFFFU;
+	}
+
+	unsigned int entry = ::get_error_entry_23127(::get_syndrome_23127_sliced(code));
+
+	errors = entry >> ERROR_WEIGHT_SHIFT;
+
+	return (code ^ (entry & ERROR_PATTERN_MASK)) >> 11;
+}
+
+unsigned int CGolay24128::decode24128(unsigned int code, unsigned int& errors)
+{
+	unsigned int data = decode23127(code >> 1, errors);
+
+	// The extended parity bit makes the weight of the codeword even, and
+	// correcting the (23,12) code word flips its parity once for each error
+	unsigned int parity = CBitUtils::parity(code >> 1) ^ errors;
+	errors += (code ^ parity) & 0x01U;
+
+	return data;
+}
+
+unsigned int CGolay24128::correct23127(unsigned int code, unsigned int& pattern)
+{
+	if (direct_table_23127 != NULL) {
+		unsigned int data = direct_table_23127[code] & 0xFFFU;
+		pattern = code ^ (encode23127(data) >> 1);
+		return data;
+	}
+
+	unsigned int syndrome = ::get_syndrome_23127_sliced(code);
+	pattern = ::get_error_entry_23127(syndrome) & ERROR_PATTERN_MASK;
+
+	code ^= pattern;
+
+	return code >> 11;
+}
+
+unsigned int CGolay24128::correct24128(unsigned int code, unsigned int& pattern)
+{
+	unsigned int error_pattern;
+	correct23127(code >> 1, error_pattern);
+
+	unsigned int corrected = (code >> 1) ^ error_pattern;
+
+	// The extended parity bit makes the weight of the codeword even
+	unsigned int parity = CBitUtils::parity(corrected);
+
+	pattern = (error_pattern << 1) | ((code ^ parity) & 0x01U);
+
+	return corrected >> 11;
+}
+
+unsigned int CGolay24128::syndrome23127(unsigned int code)
+{
+	return ::get_syndrome_23127_sliced(code);
+}
+
+unsigned int CGolay24128::syndrome23127Serial(unsigned int code)
+{
+	return ::get_syndrome_23127(code);
+}
+
+bool CGolay24128::setDirectTable(bool on)
+{
+	if (!on) {
+		delete[] direct_table_23127;
+		direct_table_23127 = NULL;
+		return true;
+	}
+
+	if (direct_table_23127 != NULL)
+		return true;
+
+	uint16_t* table = new(std::nothrow) uint16_t[DIRECT_TABLE_23127_LENGTH];
+	if (table == NULL)
+		return false;
+
+	for (unsigned int code = 0U; code < DIRECT_TABLE_23127_LENGTH; code++) {
+		unsigned int entry = ::get_error_entry_23127(::get_syndrome_23127_sliced(code));
+		table[code] = uint16_t(((code ^ (entry & ERROR_PATTERN_MASK)) >> 11) | ((entry >> ERROR_WEIGHT_SHIFT) << 12));
+	}
+
+	direct_table_23127 = table;
+
+	return true;
+}
+
+bool CGolay24128::hasDirectTable()
+{
+	return direct_table_23127 != NULL;
+}
+
+unsigned int CGolay24128::getTableBytes()
+{
+	unsigned int bytes = sizeof(SYNDROME_TABLE_23127_HIGH) + sizeof(SYNDROME_TABLE_23127_MID);
+
+#if defined(SMALL_TABLES)
+	return bytes + sizeof(CDecodingTable);
+#else
+	return bytes + sizeof(ENCODING_TABLE_23127) + sizeof(ENCODING_TABLE_24128) + sizeof(DECODING_TABLE_23127);
+#endif
+}
@@ -27,6 +27,26 @@ public:
 	static unsigned int decode23127(unsigned int code);
 	static unsigned int decode24128(unsigned int code);
 	static unsigned int decode24128(unsigned char* bytes);
+
+	// As above, but also return the number of bits that were corrected
+	static unsigned int decode23127(unsigned int code, unsigned int& errors);
+	static unsigned int decode24128(unsigned int code, unsigned int& errors);
+
+	// As above, but return the bits that were flipped to correct the code word
+	static unsigned int correct23127(unsigned int code, unsigned int& pattern);
+	static unsigned int correct24128(unsigned int code, unsigned int& pattern);
+
+	// The byte sliced table syndrome used by the decoders, and the original bit serial one
+	static unsigned int syndrome23127(unsigned int code);
+	static unsigned int syndrome23127Serial(unsigned int code);
+
+	// A 2^23 entry (16 MB) table that decodes a (23,12) code word in one lookup,
+	// enable it before decoding starts, returns false if there isn't the memory
+	static bool setDirectTable(bool on);
+	static bool hasDirectTable();
+
+	// The size of the encoding, syndrome and decoding tables, not counting the direct table
+	static unsigned int getTableBytes();
 };
 
 #endif
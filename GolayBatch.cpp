@@ -0,0 +1,203 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "GolayBatch.h"
+#include "GolayBatchKernel.h"
+#include "CPUDispatch.h"
+#include "Golay24128.h"
+#include "BitUtils.h"
+
+#include <cstdio>
+#include <cassert>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define	GOLAY_BATCH_X86
+#endif
+
+// The most lanes of any type, the size of the pattern buffer
+const unsigned int MAX_LANES = 512U;
+
+static GOLAY_BATCH_TYPE type_used = GBT_TABLE;
+
+void CGolayBatch::decode23127(const unsigned int* codes, unsigned int* data, unsigned int* errors, unsigned int count)
+{
+	assert(codes != NULL);
+	assert(data != NULL);
+
+	if (type_used == GBT_TABLE) {
+		unsigned int e;
+		for (unsigned int i = 0U; i < count; i++) {
+			data[i] = CGolay24128::decode23127(codes[i] & 0x7FFFFFU, e);
+			if (errors != NULL)
+				errors[i] = e;
+		}
+		return;
+	}
+
+	unsigned int patterns[MAX_LANES];
+
+	while (count > 0U) {
+		unsigned int n = count > MAX_LANES ? MAX_LANES : count;
+
+		decode(codes, patterns, n);
+
+		for (unsigned int i = 0U; i < n; i++) {
+			data[i] = ((codes[i] ^ patterns[i]) >> 11) & 0xFFFU;
+			if (errors != NULL)
+				errors[i] = CBitUtils::countBits(patterns[i]);
+		}
+
+		codes += n;
+		data  += n;
+		if (errors != NULL)
+			errors += n;
+		count -= n;
+	}
+}
+
+void CGolayBatch::decode24128(const unsigned int* codes, unsigned int* data, unsigned int* errors, unsigned int count)
+{
+	assert(codes != NULL);
+	assert(data != NULL);
+
+	if (type_used == GBT_TABLE) {
+		unsigned int e;
+		for (unsigned int i = 0U; i < count; i++) {
+			data[i] = CGolay24128::decode24128(codes[i] & 0xFFFFFFU, e);
+			if (errors != NULL)
+				errors[i] = e;
+		}
+		return;
+	}
+
+	unsigned int shifted[MAX_LANES];
+	unsigned int patterns[MAX_LANES];
+
+	while (count > 0U) {
+		unsigned int n = count > MAX_LANES ? MAX_LANES : count;
+
+		for (unsigned int i = 0U; i < n; i++)
+			shifted[i] = (codes[i] >> 1) & 0x7FFFFFU;
+
+		decode(shifted, patterns, n);
+
+		for (unsigned int i = 0U; i < n; i++) {
+			unsigned int corrected = shifted[i] ^ patterns[i];
+
+			data[i] = corrected >> 11;
+
+			// As CGolay24128, the extended parity bit makes the weight of the code word even
+			if (errors != NULL) {
+				unsigned int parity = CBitUtils::countBits(corrected) & 0x01U;
+				errors[i] = CBitUtils::countBits(patterns[i]) + ((codes[i] ^ parity) & 0x01U);
+			}
+		}
+
+		codes += n;
+		data  += n;
+		if (errors != NULL)
+			errors += n;
+		count -= n;
+	}
+}
+
+void CGolayBatch::decode(const unsigned int* codes, unsigned int* patterns, unsigned int count)
+{
+	unsigned int lanes = getLanes(type_used);
+
+	for (unsigned int i = 0U; i < count; i += lanes) {
+		unsigned int n = (count - i) > lanes ? lanes : (count - i);
+
+		switch (type_used) {
+		case GBT_AVX512:
+			decodeAVX512(codes + i, patterns + i, n);
+			break;
+		case GBT_AVX2:
+			decodeAVX2(codes + i, patterns + i, n);
+			break;
+		default:
+			decodeScalar(codes + i, patterns + i, n);
+			break;
+		}
+	}
+}
+
+void CGolayBatch::decodeScalar(const unsigned int* codes, unsigned int* patterns, unsigned int count)
+{
+	::golay_batch_decode<uint64_t>(codes, patterns, count);
+}
+
+bool CGolayBatch::setType(GOLAY_BATCH_TYPE type)
+{
+	if (!isSupported(type))
+		return false;
+
+	type_used = type;
+
+	return true;
+}
+
+GOLAY_BATCH_TYPE CGolayBatch::getType()
+{
+	return type_used;
+}
+
+bool CGolayBatch::isSupported(GOLAY_BATCH_TYPE type)
+{
+	switch (type) {
+	case GBT_TABLE:
+	case GBT_SCALAR:
+		return true;
+#if defined(GOLAY_BATCH_X86)
+	case GBT_AVX2:
+		return CCPUDispatch::has(CPU_AVX2);
+	case GBT_AVX512:
+		return CCPUDispatch::has(CPU_AVX512);
+#endif
+	default:
+		return false;
+	}
+}
+
+const char* CGolayBatch::getName(GOLAY_BATCH_TYPE type)
+{
+	switch (type) {
+	case GBT_TABLE:
+		return "table";
+	case GBT_AVX2:
+		return "AVX2";
+	case GBT_AVX512:
+		return "AVX-512";
+	default:
+		return "64-bit";
+	}
+}
+
+unsigned int CGolayBatch::getLanes(GOLAY_BATCH_TYPE type)
+{
+	switch (type) {
+	case GBT_TABLE:
+		return 1U;
+	case GBT_AVX2:
+		return 256U;
+	case GBT_AVX512:
+		return 512U;
+	default:
+		return 64U;
+	}
+}
@@ -0,0 +1,57 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(GOLAYBATCH_H)
+#define	GOLAYBATCH_H
+
+enum GOLAY_BATCH_TYPE {
+	GBT_TABLE,
+	GBT_SCALAR,
+	GBT_AVX2,
+	GBT_AVX512
+};
+
+// Decodes large numbers of Golay code words at once, for offline captures
+// and simulations. The table type runs the byte sliced CGolay24128 decoder
+// over the array, and is the default as it is the fastest while its tables
+// stay in cache. The others transpose the code words into bit planes, 64,
+// 256 or 512 at a time depending on the instruction set, and decode them
+// with boolean operations only, needing no tables. The results are the same
+// for every type.
+class CGolayBatch {
+public:
+	// The errors may be NULL if the number of corrected bits isn't needed
+	static void decode23127(const unsigned int* codes, unsigned int* data, unsigned int* errors, unsigned int count);
+	static void decode24128(const unsigned int* codes, unsigned int* data, unsigned int* errors, unsigned int count);
+
+	// Returns false if the CPU can't run the type asked for
+	static bool setType(GOLAY_BATCH_TYPE type);
+	static GOLAY_BATCH_TYPE getType();
+	static bool isSupported(GOLAY_BATCH_TYPE type);
+	static const char* getName(GOLAY_BATCH_TYPE type);
+	static unsigned int getLanes(GOLAY_BATCH_TYPE type);
+
+private:
+	static void decodeScalar(const unsigned int* codes, unsigned int* patterns, unsigned int count);
+	static void decodeAVX2(const unsigned int* codes, unsigned int* patterns, unsigned int count);
+	static void decodeAVX512(const unsigned int* codes, unsigned int* patterns, unsigned int count);
+
+	static void decode(const unsigned int* codes, unsigned int* patterns, unsigned int count);
+};
+
+#endif
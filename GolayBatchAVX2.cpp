@@ -0,0 +1,47 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+// Only this function is built for AVX2, CGolayBatch only calls it if the CPU has it
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define	GOLAY_BATCH_AVX2
+#endif
+
+#include "GolayBatch.h"
+#include "GolayBatchKernel.h"
+
+#include <cassert>
+
+#if defined(GOLAY_BATCH_AVX2)
+
+typedef uint64_t golay_batch_256 __attribute__((vector_size(32)));
+
+__attribute__((target("avx2")))
+void CGolayBatch::decodeAVX2(const unsigned int* codes, unsigned int* patterns, unsigned int count)
+{
+	::golay_batch_decode<golay_batch_256>(codes, patterns, count);
+}
+
+#else
+
+void CGolayBatch::decodeAVX2(const unsigned int* codes, unsigned int* patterns, unsigned int count)
+{
+	// Never called, isSupported() returns false
+	assert(false);
+}
+
+#endif
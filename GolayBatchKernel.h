@@ -0,0 +1,219 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+// The bit sliced Golay decoder, included by each of the GolayBatch source
+// files to build it for a different width of word. W is either a 64-bit
+// integer or a GCC vector of them. Everything here is static and forced
+// inline, so that each copy is built for the instruction set of the function
+// that calls it, and the copies are never merged.
+
+#if !defined(GOLAYBATCHKERNEL_H)
+#define	GOLAYBATCHKERNEL_H
+
+#include <cstdint>
+
+#if defined(__GNUC__)
+#define	GOLAY_BATCH_INLINE	inline __attribute__((always_inline))
+#else
+#define	GOLAY_BATCH_INLINE	__forceinline
+#endif
+
+// The (23,12) code extended to the (24,12) code by an even parity bit is
+// self dual, with a generator of [I | A] where A * A' = I. Row k of A holds
+// the check bits of data bit k, with the extension bit as bit 11.
+static const unsigned int GOLAY_BATCH_A[] = {
+	0xC75U, 0x49FU, 0xD4BU, 0x6E3U, 0x9B3U, 0xB66U, 0xECCU, 0x1EDU, 0x3DAU, 0x7B4U, 0xB1DU, 0xE3AU};
+
+// The transpose of A, which is also its inverse
+static const unsigned int GOLAY_BATCH_AT[] = {
+	0x49FU, 0x93EU, 0x6E3U, 0xDC6U, 0xF13U, 0xAB9U, 0x1EDU, 0x3DAU, 0x7B4U, 0xF68U, 0xA4FU, 0xC75U};
+
+static GOLAY_BATCH_INLINE void golay_batch_set(uint64_t& w, unsigned int, uint64_t v)
+{
+	w = v;
+}
+
+static GOLAY_BATCH_INLINE uint64_t golay_batch_get(const uint64_t& w, unsigned int)
+{
+	return w;
+}
+
+template <typename W>
+static GOLAY_BATCH_INLINE void golay_batch_set(W& w, unsigned int n, uint64_t v)
+{
+	w[n] = v;
+}
+
+template <typename W>
+static GOLAY_BATCH_INLINE uint64_t golay_batch_get(const W& w, unsigned int n)
+{
+	return w[n];
+}
+
+// Transposes 64 rows of 64 bits, in each 64-bit part of W at once
+template <typename W>
+static GOLAY_BATCH_INLINE void golay_batch_transpose(W* a)
+{
+	uint64_t m = 0x00000000FFFFFFFFULL;
+
+	for (unsigned int j = 32U; j != 0U; j >>= 1, m ^= (m << j)) {
+		for (unsigned int k = 0U; k < 64U; k = ((k | j) + 1U) & ~j) {
+			W t = ((a[k] >> j) ^ a[k | j]) & m;
+			a[k]     ^= t << j;
+			a[k | j] ^= t;
+		}
+	}
+}
+
+// True in each lane with more than two, or more than three, of the twelve bits set
+template <typename W>
+static GOLAY_BATCH_INLINE void golay_batch_weight(const W* x, W& ge3, W& ge4)
+{
+	W c0 = x[0U] ^ x[0U];
+	W c1 = c0;
+	W c2 = c0;
+
+	for (unsigned int i = 0U; i < 12U; i++) {
+		W t0 = c0 & x[i];
+		c0 ^= x[i];
+		W t1 = c1 & t0;
+		c1 ^= t0;
+		c2 |= t1;
+	}
+
+	ge3 = c2 | (c1 & c0);
+	ge4 = c2;
+}
+
+// Decodes up to 64 * (sizeof(W) / 8) (23,12) code words into their error patterns.
+// With the extension bit set to the inverse of the received parity the (24,12) word
+// always has three or fewer errors, and the standard (24,12) decoder can be used.
+template <typename W>
+static GOLAY_BATCH_INLINE void golay_batch_decode(const unsigned int* codes, unsigned int* patterns, unsigned int count)
+{
+	const unsigned int BLOCKS = sizeof(W) / sizeof(uint64_t);
+
+	W a[64U];
+	for (unsigned int r = 0U; r < 64U; r++) {
+		for (unsigned int q = 0U; q < BLOCKS; q++) {
+			unsigned int n = q * 64U + r;
+			golay_batch_set(a[r], q, n < count ? (codes[n] & 0x7FFFFFU) : 0U);
+		}
+	}
+
+	// Each of the 23 bits of the code words is now a bit plane
+	golay_batch_transpose(a);
+
+	W zero = a[63U] ^ a[63U];
+	W ones = ~zero;
+
+	W parity = a[0U];
+	for (unsigned int b = 1U; b < 23U; b++)
+		parity ^= a[b];
+
+	// The syndrome, s = d * A + p
+	W s[12U];
+	for (unsigned int j = 0U; j < 11U; j++)
+		s[j] = a[j];
+	s[11U] = ~parity;
+
+	for (unsigned int k = 0U; k < 12U; k++) {
+		for (unsigned int j = 0U; j < 12U; j++) {
+			if ((GOLAY_BATCH_A[k] >> j) & 0x01U)
+				s[j] ^= a[k + 11U];
+		}
+	}
+
+	W ed[12U];
+	W ep[12U];
+
+	// The errors are only in the check bits
+	W ge3, ge4;
+	golay_batch_weight(s, ge3, ge4);
+	W found = ~ge4;
+	for (unsigned int j = 0U; j < 12U; j++) {
+		ep[j] = s[j] & found;
+		ed[j] = zero;
+	}
+
+	// One error in data bit i, up to two in the check bits
+	W v[12U];
+	for (unsigned int i = 0U; i < 12U; i++) {
+		for (unsigned int j = 0U; j < 12U; j++)
+			v[j] = s[j] ^ (((GOLAY_BATCH_A[i] >> j) & 0x01U) ? ones : zero);
+
+		golay_batch_weight(v, ge3, ge4);
+		W m = ~ge3 & ~found;
+
+		for (unsigned int j = 0U; j < 12U; j++)
+			ep[j] |= v[j] & m;
+		ed[i] |= m;
+		found |= m;
+	}
+
+	// The second syndrome, s2 = s * A'
+	W s2[12U];
+	for (unsigned int i = 0U; i < 12U; i++) {
+		s2[i] = zero;
+		for (unsigned int j = 0U; j < 12U; j++) {
+			if ((GOLAY_BATCH_A[i] >> j) & 0x01U)
+				s2[i] ^= s[j];
+		}
+	}
+
+	// The errors are only in the data bits
+	golay_batch_weight(s2, ge3, ge4);
+	W m = ~ge4 & ~found;
+	for (unsigned int i = 0U; i < 12U; i++)
+		ed[i] |= s2[i] & m;
+	found |= m;
+
+	// One error in check bit j, up to two in the data bits
+	for (unsigned int j = 0U; j < 12U; j++) {
+		for (unsigned int i = 0U; i < 12U; i++)
+			v[i] = s2[i] ^ (((GOLAY_BATCH_AT[j] >> i) & 0x01U) ? ones : zero);
+
+		golay_batch_weight(v, ge3, ge4);
+		m = ~ge3 & ~found;
+
+		for (unsigned int i = 0U; i < 12U; i++)
+			ed[i] |= v[i] & m;
+		ep[j] |= m;
+		found |= m;
+	}
+
+	// Back to one error pattern per code word, the extension bit is dropped
+	for (unsigned int b = 0U; b < 11U; b++)
+		a[b] = ep[b];
+	for (unsigned int b = 0U; b < 12U; b++)
+		a[b + 11U] = ed[b];
+	for (unsigned int b = 23U; b < 64U; b++)
+		a[b] = zero;
+
+	golay_batch_transpose(a);
+
+	for (unsigned int r = 0U; r < 64U; r++) {
+		for (unsigned int q = 0U; q < BLOCKS; q++) {
+			unsigned int n = q * 64U + r;
+			if (n < count)
+				patterns[n] = (unsigned int)golay_batch_get(a[r], q);
+		}
+	}
+}
+
+#endif
@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2015,2016 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2015,2016,2026 by Jonathan Naylor G4KLX
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -17,333 +17,341 @@
  */
 
 #include "Hamming.h"
+#include "BitUtils.h"
 
 #include <cstdio>
 #include <cassert>
 
- // Hamming (15,11,3) check a boolean data array
-bool CHamming::decode15113_1(bool* d)
+// The code words are held with the first bit, d[0], as the most significant.
+// Each row is one parity check over the code word, including its own check
+// bit, so the syndrome is the parity of the code word masked by each row and
+// the error table gives the bit to flip for each syndrome, or zero.
+const unsigned int HAMMING_15113_1_ROWS[] = {0x7F08U, 0x78E4U, 0x66D2U, 0x55B1U};
+const unsigned int HAMMING_15113_1_ERRORS[] = {
+	0x0000U, 0x0008U, 0x0004U, 0x0800U, 0x0002U, 0x0200U, 0x0040U, 0x2000U,
+	0x0001U, 0x0100U, 0x0020U, 0x1000U, 0x0010U, 0x0400U, 0x0080U, 0x4000U};
+
+const unsigned int HAMMING_15113_2_ROWS[] = {0x7AC8U, 0x3D64U, 0x1EB2U, 0x7591U};
+const unsigned int HAMMING_15113_2_ERRORS[] = {
+	0x0000U, 0x0008U, 0x0004U, 0x0040U, 0x0002U, 0x0200U, 0x0020U, 0x0800U,
+	0x0001U, 0x4000U, 0x0100U, 0x2000U, 0x0010U, 0x0080U, 0x0400U, 0x1000U};
+
+const unsigned int HAMMING_1393_ROWS[] = {0x1AC8U, 0x1D64U, 0x1EB2U, 0x1591U};
+const unsigned int HAMMING_1393_ERRORS[] = {
+	0x0000U, 0x0008U, 0x0004U, 0x0040U, 0x0002U, 0x0200U, 0x0020U, 0x0800U,
+	0x0001U, 0x0000U, 0x0100U, 0x0000U, 0x0010U, 0x0080U, 0x0400U, 0x1000U};
+
+const unsigned int HAMMING_1063_ROWS[] = {0x0398U, 0x0354U, 0x02E2U, 0x01E1U};
+const unsigned int HAMMING_1063_ERRORS[] = {
+	0x0000U, 0x0008U, 0x0004U, 0x0010U, 0x0002U, 0x0000U, 0x0000U, 0x0200U,
+	0x0001U, 0x0000U, 0x0000U, 0x0100U, 0x0020U, 0x0080U, 0x0040U, 0x0000U};
+
+const unsigned int HAMMING_16114_ROWS[] = {0xF590U, 0x7AC8U, 0x3D64U, 0xEB22U, 0xA6E1U};
+const unsigned int HAMMING_16114_ERRORS[] = {
+	0x0000U, 0x0010U, 0x0008U, 0x0000U, 0x0004U, 0x0000U, 0x0000U, 0x1000U,
+	0x0002U, 0x0000U, 0x0000U, 0x4000U, 0x0000U, 0x0100U, 0x0800U, 0x0000U,
+	0x0001U, 0x0000U, 0x0000U, 0x0080U, 0x0000U, 0x0400U, 0x0040U, 0x0000U,
+	0x0000U, 0x8000U, 0x0200U, 0x0000U, 0x0020U, 0x0000U, 0x0000U, 0x2000U};
+
+const unsigned int HAMMING_17123_ROWS[] = {0x1E690U, 0x1F348U, 0x0F9A4U, 0x19A42U, 0x1CD21U};
+const unsigned int HAMMING_17123_ERRORS[] = {
+	0x00000U, 0x00010U, 0x00008U, 0x00000U, 0x00004U, 0x00080U, 0x00000U, 0x02000U,
+	0x00002U, 0x00000U, 0x00040U, 0x00200U, 0x00000U, 0x00000U, 0x01000U, 0x00000U,
+	0x00001U, 0x00400U, 0x00000U, 0x00000U, 0x00020U, 0x00000U, 0x00100U, 0x04000U,
+	0x00000U, 0x00000U, 0x00000U, 0x10000U, 0x00800U, 0x00000U, 0x00000U, 0x08000U};
+
+static unsigned int syndrome(unsigned int code, const unsigned int* rows, unsigned int checks)
 {
-	assert(d != NULL);
+	unsigned int n = 0U;
+	for (unsigned int i = 0U; i < checks; i++)
+		n |= CBitUtils::parity(code & rows[i]) << i;
+
+	return n;
+}
+
+// The check bits are zero, so the rows can be used as they are
+static unsigned int addChecks(unsigned int code, const unsigned int* rows, unsigned int checks)
+{
+	for (unsigned int i = 0U; i < checks; i++)
+		code |= CBitUtils::parity(code & rows[i]) << (checks - 1U - i);
 
-	// Calculate the parity it should have
-	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[6];
-	bool c1 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[7] ^ d[8] ^ d[9];
-	bool c2 = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[8] ^ d[10];
-	bool c3 = d[0] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[9] ^ d[10];
+	return code;
+}
+
+static unsigned int pack(const bool* d, unsigned int length)
+{
+	unsigned int code = 0U;
+	for (unsigned int i = 0U; i < length; i++)
+		code = (code << 1) | (d[i] ? 0x01U : 0x00U);
 
-	unsigned char n = 0U;
-	n |= (c0 != d[11]) ? 0x01U : 0x00U;
-	n |= (c1 != d[12]) ? 0x02U : 0x00U;
-	n |= (c2 != d[13]) ? 0x04U : 0x00U;
-	n |= (c3 != d[14]) ? 0x08U : 0x00U;
+	return code;
+}
 
-	switch (n)
+static void unpack(unsigned int code, bool* d, unsigned int length)
+{
+	for (unsigned int i = 0U; i < length; i++)
+		d[i] = ((code >> (length - 1U - i)) & 0x01U) == 0x01U;
+}
+
+// The syndrome is linear, so it can be looked up a byte at a time for codes of up to 17 bits
+class CSyndromeTable {
+public:
+	CSyndromeTable(const unsigned int* rows, unsigned int checks)
+	{
+		for (unsigned int i = 0U; i < 256U; i++)
+			m_low[i] = syndrome(i, rows, checks);
+		for (unsigned int i = 0U; i < 512U; i++)
+			m_high[i] = syndrome(i << 8, rows, checks);
+	}
+
+	unsigned int get(unsigned int code) const
 	{
-		// Parity bit errors
-		case 0x01U: d[11] = !d[11]; return true;
-		case 0x02U: d[12] = !d[12]; return true;
-		case 0x04U: d[13] = !d[13]; return true;
-		case 0x08U: d[14] = !d[14]; return true;
-
-		// Data bit errors
-		case 0x0FU: d[0]  = !d[0];  return true;
-		case 0x07U: d[1]  = !d[1];  return true;
-		case 0x0BU: d[2]  = !d[2];  return true;
-		case 0x03U: d[3]  = !d[3];  return true;
-		case 0x0DU: d[4]  = !d[4];  return true;
-		case 0x05U: d[5]  = !d[5];  return true;
-		case 0x09U: d[6]  = !d[6];  return true;
-		case 0x0EU: d[7]  = !d[7];  return true;
-		case 0x06U: d[8]  = !d[8];  return true;
-		case 0x0AU: d[9]  = !d[9];  return true;
-		case 0x0CU: d[10] = !d[10]; return true;
-
-		// No bit errors
-		default: return false;
+		return m_low[code & 0xFFU] ^ m_high[(code >> 8) & 0x1FFU];
 	}
+
+private:
+	unsigned char m_low[256U];
+	unsigned char m_high[512U];
+};
+
+// Used by the P25 IMBE decoder for three code words a frame
+static const CSyndromeTable& syndromes_15113_1()
+{
+	static const CSyndromeTable t(HAMMING_15113_1_ROWS, 4U);
+
+	return t;
+}
+
+// Hamming (15,11,3), returns true if a bit was corrected
+bool CHamming::decode15113_1(unsigned int& code)
+{
+	unsigned int n = syndromes_15113_1().get(code);
+	if (n == 0x00U)
+		return false;
+
+	unsigned int error = HAMMING_15113_1_ERRORS[n];
+	if (error == 0x00U)
+		return false;
+
+	code ^= error;
+
+	return true;
+}
+
+unsigned int CHamming::encode15113_1(unsigned int data)
+{
+	return addChecks((data & 0x7FFU) << 4, HAMMING_15113_1_ROWS, 4U);
+}
+
+bool CHamming::decode15113_1(bool* d)
+{
+	assert(d != NULL);
+
+	unsigned int code = pack(d, 15U);
+	bool ret = decode15113_1(code);
+	unpack(code, d, 15U);
+
+	return ret;
 }
 
 void CHamming::encode15113_1(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this row should have
-	d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[6];
-	d[12] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[7] ^ d[8] ^ d[9];
-	d[13] = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[8] ^ d[10];
-	d[14] = d[0] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[9] ^ d[10];
+	unpack(encode15113_1(pack(d, 11U)), d, 15U);
+}
+
+// Hamming (15,11,3), returns true if a bit was corrected
+bool CHamming::decode15113_2(unsigned int& code)
+{
+	unsigned int n = syndrome(code, HAMMING_15113_2_ROWS, 4U);
+	if (n == 0x00U)
+		return false;
+
+	unsigned int error = HAMMING_15113_2_ERRORS[n];
+	if (error == 0x00U)
+		return false;
+
+	code ^= error;
+
+	return true;
+}
+
+unsigned int CHamming::encode15113_2(unsigned int data)
+{
+	return addChecks((data & 0x7FFU) << 4, HAMMING_15113_2_ROWS, 4U);
 }
 
-// Hamming (15,11,3) check a boolean data array
 bool CHamming::decode15113_2(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this row should have
-	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-	bool c1 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
-	bool c2 = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
-	bool c3 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
-
-	unsigned char n = 0x00U;
-	n |= (c0 != d[11]) ? 0x01U : 0x00U;
-	n |= (c1 != d[12]) ? 0x02U : 0x00U;
-	n |= (c2 != d[13]) ? 0x04U : 0x00U;
-	n |= (c3 != d[14]) ? 0x08U : 0x00U;
-
-	switch (n) {
-		// Parity bit errors
-		case 0x01U: d[11] = !d[11]; return true;
-		case 0x02U: d[12] = !d[12]; return true;
-		case 0x04U: d[13] = !d[13]; return true;
-		case 0x08U: d[14] = !d[14]; return true;
-
-		// Data bit errors
-		case 0x09U: d[0]  = !d[0];  return true;
-		case 0x0BU: d[1]  = !d[1];  return true;
-		case 0x0FU: d[2]  = !d[2];  return true;
-		case 0x07U: d[3]  = !d[3];  return true;
-		case 0x0EU: d[4]  = !d[4];  return true;
-		case 0x05U: d[5]  = !d[5];  return true;
-		case 0x0AU: d[6]  = !d[6];  return true;
-		case 0x0DU: d[7]  = !d[7];  return true;
-		case 0x03U: d[8]  = !d[8];  return true;
-		case 0x06U: d[9]  = !d[9];  return true;
-		case 0x0CU: d[10] = !d[10]; return true;
-
-		// No bit errors
-		default: return false;
-	}
+	unsigned int code = pack(d, 15U);
+	bool ret = decode15113_2(code);
+	unpack(code, d, 15U);
+
+	return ret;
 }
 
 void CHamming::encode15113_2(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this row should have
-	d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-	d[12] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
-	d[13] = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
-	d[14] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
+	unpack(encode15113_2(pack(d, 11U)), d, 15U);
+}
+
+// Hamming (13,9,3), returns true if a bit was corrected
+bool CHamming::decode1393(unsigned int& code)
+{
+	unsigned int n = syndrome(code, HAMMING_1393_ROWS, 4U);
+	if (n == 0x00U)
+		return false;
+
+	unsigned int error = HAMMING_1393_ERRORS[n];
+	if (error == 0x00U)
+		return false;
+
+	code ^= error;
+
+	return true;
+}
+
+unsigned int CHamming::encode1393(unsigned int data)
+{
+	return addChecks((data & 0x1FFU) << 4, HAMMING_1393_ROWS, 4U);
 }
 
-// Hamming (13,9,3) check a boolean data array
 bool CHamming::decode1393(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this column should have
-	bool c0 = d[0] ^ d[1] ^ d[3] ^ d[5] ^ d[6];
-	bool c1 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7];
-	bool c2 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-	bool c3 = d[0] ^ d[2] ^ d[4] ^ d[5] ^ d[8];
-	
-	unsigned char n = 0x00U;
-	n |= (c0 != d[9])  ? 0x01U : 0x00U;
-	n |= (c1 != d[10]) ? 0x02U : 0x00U;
-	n |= (c2 != d[11]) ? 0x04U : 0x00U;
-	n |= (c3 != d[12]) ? 0x08U : 0x00U;
-
-	switch (n) {
-		// Parity bit errors
-		case 0x01U: d[9]  = !d[9];  return true;
-		case 0x02U: d[10] = !d[10]; return true;
-		case 0x04U: d[11] = !d[11]; return true;
-		case 0x08U: d[12] = !d[12]; return true;
-
-		// Data bit erros
-		case 0x0FU: d[0] = !d[0]; return true;
-		case 0x07U: d[1] = !d[1]; return true;
-		case 0x0EU: d[2] = !d[2]; return true;
-		case 0x05U: d[3] = !d[3]; return true;
-		case 0x0AU: d[4] = !d[4]; return true;
-		case 0x0DU: d[5] = !d[5]; return true;
-		case 0x03U: d[6] = !d[6]; return true;
-		case 0x06U: d[7] = !d[7]; return true;
-		case 0x0CU: d[8] = !d[8]; return true;
-
-		// No bit errors
-		default: return false;
-	}
+	unsigned int code = pack(d, 13U);
+	bool ret = decode1393(code);
+	unpack(code, d, 13U);
+
+	return ret;
 }
 
 void CHamming::encode1393(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this column should have
-	d[9]  = d[0] ^ d[1] ^ d[3] ^ d[5] ^ d[6];
-	d[10] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7];
-	d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-	d[12] = d[0] ^ d[2] ^ d[4] ^ d[5] ^ d[8];
+	unpack(encode1393(pack(d, 9U)), d, 13U);
+}
+
+// Hamming (10,6,3), returns true if a bit was corrected
+bool CHamming::decode1063(unsigned int& code)
+{
+	unsigned int n = syndrome(code, HAMMING_1063_ROWS, 4U);
+	if (n == 0x00U)
+		return false;
+
+	unsigned int error = HAMMING_1063_ERRORS[n];
+	if (error == 0x00U)
+		return false;
+
+	code ^= error;
+
+	return true;
+}
+
+unsigned int CHamming::encode1063(unsigned int data)
+{
+	return addChecks((data & 0x3FU) << 4, HAMMING_1063_ROWS, 4U);
 }
 
-// Hamming (10,6,3) check a boolean data array
 bool CHamming::decode1063(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this column should have
-	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[5];
-	bool c1 = d[0] ^ d[1] ^ d[3] ^ d[5];
-	bool c2 = d[0] ^ d[2] ^ d[3] ^ d[4];
-	bool c3 = d[1] ^ d[2] ^ d[3] ^ d[4];
-
-	unsigned char n = 0x00U;
-	n |= (c0 != d[6]) ? 0x01U : 0x00U;
-	n |= (c1 != d[7]) ? 0x02U : 0x00U;
-	n |= (c2 != d[8]) ? 0x04U : 0x00U;
-	n |= (c3 != d[9]) ? 0x08U : 0x00U;
-
-	switch (n) {
-		// Parity bit errors
-		case 0x01U: d[6] = !d[6]; return true;
-		case 0x02U: d[7] = !d[7]; return true;
-		case 0x04U: d[8] = !d[8]; return true;
-		case 0x08U: d[9] = !d[9]; return true;
-
-		// Data bit erros
-		case 0x07U: d[0] = !d[0]; return true;
-		case 0x0BU: d[1] = !d[1]; return true;
-		case 0x0DU: d[2] = !d[2]; return true;
-		case 0x0EU: d[3] = !d[3]; return true;
-		case 0x0CU: d[4] = !d[4]; return true;
-		case 0x03U: d[5] = !d[5]; return true;
-
-		// No bit errors
-		default: return false;
-	}
+	unsigned int code = pack(d, 10U);
+	bool ret = decode1063(code);
+	unpack(code, d, 10U);
+
+	return ret;
 }
 
 void CHamming::encode1063(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this column should have
-	d[6] = d[0] ^ d[1] ^ d[2] ^ d[5];
-	d[7] = d[0] ^ d[1] ^ d[3] ^ d[5];
-	d[8] = d[0] ^ d[2] ^ d[3] ^ d[4];
-	d[9] = d[1] ^ d[2] ^ d[3] ^ d[4];
+	unpack(encode1063(pack(d, 6U)), d, 10U);
+}
+
+// Hamming (16,11,4), returns false if the errors can't be corrected
+bool CHamming::decode16114(unsigned int& code)
+{
+	unsigned int n = syndrome(code, HAMMING_16114_ROWS, 5U);
+	if (n == 0x00U)
+		return true;
+
+	unsigned int error = HAMMING_16114_ERRORS[n];
+	if (error == 0x00U)
+		return false;
+
+	code ^= error;
+
+	return true;
+}
+
+unsigned int CHamming::encode16114(unsigned int data)
+{
+	return addChecks((data & 0x7FFU) << 5, HAMMING_16114_ROWS, 5U);
 }
 
-// A Hamming (16,11,4) Check
 bool CHamming::decode16114(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this column should have
-	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-	bool c1 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
-	bool c2 = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
-	bool c3 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
-	bool c4 = d[0] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[9] ^ d[10];
-
-	// Compare these with the actual bits
-	unsigned char n = 0x00U;
-	n |= (c0 != d[11]) ? 0x01U : 0x00U;
-	n |= (c1 != d[12]) ? 0x02U : 0x00U;
-	n |= (c2 != d[13]) ? 0x04U : 0x00U;
-	n |= (c3 != d[14]) ? 0x08U : 0x00U;
-	n |= (c4 != d[15]) ? 0x10U : 0x00U;
-
-	switch (n) {
-		// Parity bit errors
-		case 0x01U: d[11] = !d[11]; return true;
-		case 0x02U: d[12] = !d[12]; return true;
-		case 0x04U: d[13] = !d[13]; return true;
-		case 0x08U: d[14] = !d[14]; return true;
-		case 0x10U: d[15] = !d[15]; return true;
-
-		// Data bit errors
-		case 0x19U: d[0]  = !d[0];  return true;
-		case 0x0BU: d[1]  = !d[1];  return true;
-		case 0x1FU: d[2]  = !d[2];  return true;
-		case 0x07U: d[3]  = !d[3];  return true;
-		case 0x0EU: d[4]  = !d[4];  return true;
-		case 0x15U: d[5]  = !d[5];  return true;
-		case 0x1AU: d[6]  = !d[6];  return true;
-		case 0x0DU: d[7]  = !d[7];  return true;
-		case 0x13U: d[8]  = !d[8];  return true;
-		case 0x16U: d[9]  = !d[9];  return true;
-		case 0x1CU: d[10] = !d[10]; return true;
-
-		// No bit errors
-		case 0x00U: return true;
-
-		// Unrecoverable errors
-		default: return false;
-	}
+	unsigned int code = pack(d, 16U);
+	bool ret = decode16114(code);
+	unpack(code, d, 16U);
+
+	return ret;
 }
 
 void CHamming::encode16114(bool* d)
 {
 	assert(d != NULL);
 
-	d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
-	d[12] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
-	d[13] = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
-	d[14] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
-	d[15] = d[0] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[9] ^ d[10];
+	unpack(encode16114(pack(d, 11U)), d, 16U);
+}
+
+// Hamming (17,12,3), returns false if the errors can't be corrected
+bool CHamming::decode17123(unsigned int& code)
+{
+	unsigned int n = syndrome(code, HAMMING_17123_ROWS, 5U);
+	if (n == 0x00U)
+		return true;
+
+	unsigned int error = HAMMING_17123_ERRORS[n];
+	if (error == 0x00U)
+		return false;
+
+	code ^= error;
+
+	return true;
+}
+
+unsigned int CHamming::encode17123(unsigned int data)
+{
+	return addChecks((data & 0xFFFU) << 5, HAMMING_17123_ROWS, 5U);
 }
 
-// A Hamming (17,12,3) Check
 bool CHamming::decode17123(bool* d)
 {
 	assert(d != NULL);
 
-	// Calculate the checksum this column should have
-	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[6] ^ d[7] ^ d[9];
-	bool c1 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[7] ^ d[8] ^ d[10];
-	bool c2 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[8] ^ d[9] ^ d[11];
-	bool c3 = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[10];
-	bool c4 = d[0] ^ d[1] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[11];
-
-	// Compare these with the actual bits
-	unsigned char n = 0x00U;
-	n |= (c0 != d[12]) ? 0x01U : 0x00U;
-	n |= (c1 != d[13]) ? 0x02U : 0x00U;
-	n |= (c2 != d[14]) ? 0x04U : 0x00U;
-	n |= (c3 != d[15]) ? 0x08U : 0x00U;
-	n |= (c4 != d[16]) ? 0x10U : 0x00U;
-
-	switch (n) {
-		// Parity bit errors
-		case 0x01U: d[12] = !d[12]; return true;
-		case 0x02U: d[13] = !d[13]; return true;
-		case 0x04U: d[14] = !d[14]; return true;
-		case 0x08U: d[15] = !d[15]; return true;
-		case 0x10U: d[16] = !d[16]; return true;
-
-		// Data bit errors
-		case 0x1BU: d[0]  = !d[0];  return true;
-		case 0x1FU: d[1]  = !d[1];  return true;
-		case 0x17U: d[2]  = !d[2];  return true;
-		case 0x07U: d[3]  = !d[3];  return true;
-		case 0x0EU: d[4]  = !d[4];  return true;
-		case 0x1CU: d[5]  = !d[5];  return true;
-		case 0x11U: d[6]  = !d[6];  return true;
-		case 0x0BU: d[7]  = !d[7];  return true;
-		case 0x16U: d[8]  = !d[8];  return true;
-		case 0x05U: d[9]  = !d[9];  return true;
-		case 0x0AU: d[10] = !d[10]; return true;
-		case 0x14U: d[11] = !d[11]; return true;
-
-		// No bit errors
-		case 0x00U: return true;
-
-		// Unrecoverable errors
-		default: return false;
-	}
+	unsigned int code = pack(d, 17U);
+	bool ret = decode17123(code);
+	unpack(code, d, 17U);
+
+	return ret;
 }
 
 void CHamming::encode17123(bool* d)
 {
 	assert(d != NULL);
 
-	d[12] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[6] ^ d[7] ^ d[9];
-	d[13] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[7] ^ d[8] ^ d[10];
-	d[14] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[8] ^ d[9] ^ d[11];
-	d[15] = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[10];
-	d[16] = d[0] ^ d[1] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[11];
+	unpack(encode17123(pack(d, 12U)), d, 17U);
 }
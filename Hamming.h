@@ -19,25 +19,46 @@
 #ifndef	Hamming_H
 #define	Hamming_H
 
+// Each code has a bool array version, with d[0] the first bit, and a packed
+// version with d[0] as the most significant bit of the code word. The
+// packed encoders take the data bits alone and return the whole code word.
 class CHamming {
 public:
 	static void encode15113_1(bool* d);
 	static bool decode15113_1(bool* d);
 
+	static unsigned int encode15113_1(unsigned int data);
+	static bool decode15113_1(unsigned int& code);
+
 	static void encode15113_2(bool* d);
 	static bool decode15113_2(bool* d);
 
+	static unsigned int encode15113_2(unsigned int data);
+	static bool decode15113_2(unsigned int& code);
+
 	static void encode1393(bool* d);
 	static bool decode1393(bool* d);
 
+	static unsigned int encode1393(unsigned int data);
+	static bool decode1393(unsigned int& code);
+
 	static void encode1063(bool* d);
 	static bool decode1063(bool* d);
 
+	static unsigned int encode1063(unsigned int data);
+	static bool decode1063(unsigned int& code);
+
 	static void encode16114(bool* d);
 	static bool decode16114(bool* d);
 
+	static unsigned int encode16114(unsigned int data);
+	static bool decode16114(unsigned int& code);
+
 	static void encode17123(bool* d);
 	static bool decode17123(bool* d);
+
+	static unsigned int encode17123(unsigned int data);
+	static bool decode17123(unsigned int& code);
 };
 
 #endif
@@ -19,6 +19,9 @@
  */
 
 #include "MMDVMCal.h"
+#include "Benchmark.h"
+#include "CPUDispatch.h"
+#include "Verify.h"
 #include "Version.h"
 
 #include <cstdio>
@@ -53,6 +56,9 @@ const unsigned char MMDVM_DMR_SHORTLC = 0x1CU;
 const unsigned char MMDVM_DMR_START   = 0x1DU;
 const unsigned char MMDVM_DMR_ABORT   = 0x1EU;
 
+// Set in the tag of DMR data bursts, which hold no AMBE frames
+const unsigned char DMR_SYNC_DATA     = 0x40U;
+
 const unsigned char MMDVM_YSF_DATA    = 0x20U;
 const unsigned char MMDVM_YSF_LOST    = 0x21U;
 
@@ -93,10 +99,61 @@ const unsigned char MMDVM_DEBUG5      = 0xF5U;
 const unsigned int MAX_RESPONSES = 30U;
 const unsigned int BUFFER_LENGTH = 2000U;
 
+// The lengths of the received data frames from the modem, without the optional RSSI
+const unsigned int MMDVM_DSTAR_HEADER_LENGTH = 44U;
+const unsigned int MMDVM_DSTAR_DATA_LENGTH   = 15U;
+const unsigned int MMDVM_DMR_DATA_LENGTH     = 37U;
+const unsigned int MMDVM_YSF_DATA_LENGTH     = 124U;
+const unsigned int MMDVM_P25_HDR_LENGTH      = 103U;
+const unsigned int MMDVM_P25_LDU_LENGTH      = 220U;
+const unsigned int MMDVM_NXDN_DATA_LENGTH    = 52U;
+
+const char* BER_RSSI_FILE = "MMDVMCal-BER-RSSI.csv";
+
+// Receive polarity detection scores this many frames, and tries the other
+// polarity if the modem hasn't found any frames in this time, giving up
+// once each polarity has had two tries
+const unsigned int POLARITY_FRAMES  = 5U;
+const unsigned int POLARITY_HUNT_MS = 3000U;
+const unsigned int POLARITY_HUNTS   = 4U;
+
 int main(int argc, char** argv)
 {
+	if (!CCPUDispatch::checkBuild()) {
+		::fprintf(stderr, "MMDVMCal: built for POPCNT, which this CPU doesn't have, rebuild without POPCNT=1\n");
+		return 1;
+	}
+
+	// Limits the instruction set extensions that the FEC kernels may use, for
+	// comparing them, this must be done before anything is decoded
+	if (argc >= 3 && ::strcmp(argv[1], "-cpu") == 0) {
+		unsigned int features;
+		if (!CCPUDispatch::parse(argv[2], features)) {
+			::fprintf(stderr, "MMDVMCal: unknown CPU feature - %s\n", argv[2]);
+			return 1;
+		}
+
+		CCPUDispatch::setAllowed(features);
+
+		argc -= 2;
+		argv += 2;
+	}
+
+	if (argc == 2 && ::strcmp(argv[1], "-bench") == 0) {
+		CBenchmark benchmark;
+		return benchmark.run();
+	}
+
+	if (argc == 2 && ::strcmp(argv[1], "-verify") == 0) {
+		CVerify verify;
+		return verify.run();
+	}
+
 	if (argc < 3) {
-		::fprintf(stderr, "Usage: MMDVMCal <speed> <port>\n");
+		::fprintf(stderr, "Usage: MMDVMCal [-cpu <features>] <speed> <port>\n");
+		::fprintf(stderr, "       MMDVMCal [-cpu <features>] -bench\n");
+		::fprintf(stderr, "       MMDVMCal [-cpu <features>] -verify\n");
+		::fprintf(stderr, "       features is all, none, or a list of sse2, popcnt, avx2, bmi2, avx512 and pclmul\n");
 		return 1;
 	}
 
@@ -149,7 +206,13 @@ m_nxdnEnabled(false),
 m_m17Enabled(false),
 m_pocsagEnabled(false),
 m_fmEnabled(false),
-m_ax25Enabled(false)
+m_ax25Enabled(false),
+m_polarityDetect(false),
+m_polarityScore(0),
+m_polarityFrames(0U),
+m_polarityHunts(0U),
+m_polarityRXInvert(false),
+m_polarityTimer()
 {
 	m_buffer = new unsigned char[BUFFER_LENGTH];
 }
@@ -260,6 +323,7 @@ void CMMDVMCal::loop_MMDVM()
 			case 'V':
 			case 'v':
 				::fprintf(stdout, VERSION EOL);
+				CCPUDispatch::print();
 				break;
 			case 'F':
 				setFMDeviation();
@@ -316,6 +380,18 @@ void CMMDVMCal::loop_MMDVM()
 			case 'e':
 				setM17Cal();
 				break;
+			case 'x':
+				m_ber.dumpErrorMap();
+				break;
+			case 'X':
+				m_ber.resetErrorMap();
+				break;
+			case 'y':
+				setBERRSSI();
+				break;
+			case 'u':
+				setPolarityDetect();
+				break;
 			case -1:
 			case  0:
 				break;
@@ -330,6 +406,10 @@ void CMMDVMCal::loop_MMDVM()
 			displayModem(m_buffer, m_length);
 
 		m_ber.clock();
+
+		if (m_polarityDetect)
+			clockPolarity();
+
 		sleep(5U);
 
 		if (counter >= 200U) {
@@ -373,6 +453,10 @@ void CMMDVMCal::displayHelp_MMDVM()
 	::fprintf(stdout, "    J        BER Test Mode (FEC) for YSF" EOL);
 	::fprintf(stdout, "    j        BER Test Mode (FEC) for P25" EOL);
 	::fprintf(stdout, "    n        BER Test Mode (FEC) for NXDN" EOL);
+	::fprintf(stdout, "    x        Display the BER bit error map and error bursts" EOL);
+	::fprintf(stdout, "    X        Clear the BER bit error map and error bursts" EOL);
+	::fprintf(stdout, "    y        Start/stop measuring BER against RSSI" EOL);
+	::fprintf(stdout, "    u        Detect the receive polarity in the current BER mode" EOL);
 	::fprintf(stdout, "    g        POCSAG 600Hz Test Pattern" EOL);
 	::fprintf(stdout, "    e        M17 Preamble Test Pattern" EOL);
 	::fprintf(stdout, "    S/s      RSSI Mode" EOL);
@@ -450,6 +534,7 @@ void CMMDVMCal::loop_MMDVM_HS()
 			case 'V':
 			case 'v':
 				::fprintf(stdout, VERSION EOL);
+				CCPUDispatch::print();
 				break;
 			case 'D':
 			case 'd':
@@ -489,6 +574,18 @@ void CMMDVMCal::loop_MMDVM_HS()
 			case 'i':
 				setIntCal();
 				break;
+			case 'x':
+				m_ber.dumpErrorMap();
+				break;
+			case 'X':
+				m_ber.resetErrorMap();
+				break;
+			case 'y':
+				setBERRSSI();
+				break;
+			case 'u':
+				setPolarityDetect();
+				break;
 			case -1:
 			case  0:
 				break;
@@ -503,6 +600,10 @@ void CMMDVMCal::loop_MMDVM_HS()
 			displayModem(m_buffer, m_length);
 
 		m_ber.clock();
+
+		if (m_polarityDetect)
+			clockPolarity();
+
 		sleep(5U);
 
 		if (counter >= 200U) {
@@ -538,6 +639,10 @@ void CMMDVMCal::displayHelp_MMDVM_HS()
 	::fprintf(stdout, "    J        BER Test Mode (FEC) for YSF" EOL);
 	::fprintf(stdout, "    j        BER Test Mode (FEC) for P25" EOL);
 	::fprintf(stdout, "    n        BER Test Mode (FEC) for NXDN" EOL);
+	::fprintf(stdout, "    x        Display the BER bit error map and error bursts" EOL);
+	::fprintf(stdout, "    X        Clear the BER bit error map and error bursts" EOL);
+	::fprintf(stdout, "    y        Start/stop measuring BER against RSSI" EOL);
+	::fprintf(stdout, "    u        Detect the receive polarity in the current BER mode" EOL);
 	::fprintf(stdout, "    g        POCSAG 600Hz Test Pattern" EOL);
 	::fprintf(stdout, "    S/s      RSSI Mode" EOL);
 	::fprintf(stdout, "    I/i      Interrupt Counter Mode" EOL);
@@ -1802,6 +1907,7 @@ void CMMDVMCal::displayModem(const unsigned char *buffer, unsigned int length)
 		unsigned short min = buffer[5U] << 8 | buffer[6U];
 		unsigned short ave = buffer[7U] << 8 | buffer[8U];
 		::fprintf(stdout, "RSSI: max: %u, min: %u, ave: %u" EOL, max, min, ave);
+		m_ber.RSSI(ave);
 	} else if (buffer[2U] == MMDVM_DEBUG1) {
 		::fprintf(stdout, "Debug: %.*s" EOL, length - 3U, buffer + 3U);
 	} else if (buffer[2U] == MMDVM_DEBUG2) {
@@ -1823,23 +1929,135 @@ void CMMDVMCal::displayModem(const unsigned char *buffer, unsigned int length)
 		short val4 = (buffer[length - 2U] << 8) | buffer[length - 1U];
 		::fprintf(stdout, "Debug: %.*s %d %d %d %d" EOL, length - 11U, buffer + 3U, val1, val2, val3, val4);
 	} else if (buffer[2U] == MMDVM_DSTAR_HEADER || buffer[2U] == MMDVM_DSTAR_DATA || buffer[2U] == MMDVM_DSTAR_LOST || buffer[2U] == MMDVM_DSTAR_EOT) {
+		if (buffer[2U] == MMDVM_DSTAR_HEADER)
+			frameRSSI(buffer, length, MMDVM_DSTAR_HEADER_LENGTH);
+		else if (buffer[2U] == MMDVM_DSTAR_DATA)
+			frameRSSI(buffer, length, MMDVM_DSTAR_DATA_LENGTH);
+		if (m_polarityDetect && buffer[2U] == MMDVM_DSTAR_DATA)
+			checkPolarity(m_ber.DSTARPolarity(buffer + 3U));
 		m_ber.DSTARFEC(buffer + 3U, buffer[2U]);
 	} else if (buffer[2U] == MMDVM_DMR_DATA1 || buffer[2U] == MMDVM_DMR_DATA2) {
+		frameRSSI(buffer, length, MMDVM_DMR_DATA_LENGTH);
+		if (m_polarityDetect && (buffer[3U] & DMR_SYNC_DATA) == 0x00U)
+			checkPolarity(m_ber.DMRPolarity(buffer + 4U));
 		if (m_dmrBERFEC)
 			m_ber.DMRFEC(buffer + 4U, buffer[3]);
 		else
 			m_ber.DMR1K(buffer + 4U, buffer[3]);
 	} else if (buffer[2U] == MMDVM_YSF_DATA) {
+		frameRSSI(buffer, length, MMDVM_YSF_DATA_LENGTH);
+		if (m_polarityDetect)
+			checkPolarity(m_ber.YSFPolarity(buffer + 4U));
 		m_ber.YSFFEC(buffer + 4U);
 	} else if (buffer[2U] == MMDVM_P25_HDR || buffer[2U] == MMDVM_P25_LDU) {
+		frameRSSI(buffer, length, buffer[2U] == MMDVM_P25_HDR ? MMDVM_P25_HDR_LENGTH : MMDVM_P25_LDU_LENGTH);
+		if (m_polarityDetect && buffer[2U] == MMDVM_P25_LDU)
+			checkPolarity(m_ber.P25Polarity(buffer + 4U));
 		m_ber.P25FEC(buffer + 4U);
 	} else if (buffer[2U] == MMDVM_NXDN_DATA) {
+		frameRSSI(buffer, length, MMDVM_NXDN_DATA_LENGTH);
+		if (m_polarityDetect)
+			checkPolarity(m_ber.NXDNPolarity(buffer + 4U));
 		m_ber.NXDNFEC(buffer + 4U, buffer[3U]);
 	} else if (m_hwType == HWT_MMDVM && m_mode != STATE_DMR && m_mode != STATE_P25 && m_mode != STATE_NXDN) {
 		CUtils::dump("Response", buffer, length);
 	}
 }
 
+// Modems with RSSI support append it to the received data frames
+void CMMDVMCal::frameRSSI(const unsigned char* buffer, unsigned int length, unsigned int frameLength)
+{
+	if (length < (frameLength + 2U))
+		return;
+
+	unsigned int rssi = (buffer[frameLength + 0U] << 8) | buffer[frameLength + 1U];
+	m_ber.RSSI(rssi);
+}
+
+bool CMMDVMCal::setBERRSSI()
+{
+	if (m_ber.isRSSIRunning()) {
+		m_ber.stopRSSI();
+		return true;
+	}
+
+	return m_ber.startRSSI(BER_RSSI_FILE);
+}
+
+bool CMMDVMCal::setPolarityDetect()
+{
+	m_polarityDetect = !m_polarityDetect;
+	m_polarityScore  = 0;
+	m_polarityFrames = 0U;
+	m_polarityHunts  = 0U;
+
+	if (m_polarityDetect) {
+		m_polarityRXInvert = m_rxInvert;
+		m_polarityTimer.start();
+		::fprintf(stdout, "Receive polarity detection started, transmit in the current BER mode" EOL);
+	} else {
+		::fprintf(stdout, "Receive polarity detection stopped" EOL);
+	}
+
+	return true;
+}
+
+// Each frame is decoded both as received and inverted, the best fit over a few frames wins
+void CMMDVMCal::checkPolarity(int score)
+{
+	m_polarityTimer.start();
+	m_polarityHunts = 0U;
+
+	m_polarityScore += score;
+	m_polarityFrames++;
+
+	if (m_polarityFrames < POLARITY_FRAMES)
+		return;
+
+	if (m_polarityScore == 0) {
+		// Undecided, try again
+		m_polarityFrames = 0U;
+		return;
+	}
+
+	m_polarityDetect = false;
+
+	if (m_polarityScore > 0) {
+		::fprintf(stdout, "Receive polarity detected as inverted from the current setting" EOL);
+		setRXInvert();
+	} else {
+		::fprintf(stdout, "Receive polarity detected as correct, RX Invert: %s" EOL, m_rxInvert ? "On" : "Off");
+	}
+}
+
+// The modem needs the right polarity to find the sync, so if nothing is
+// being received try the other one, and give up once both have been tried
+void CMMDVMCal::clockPolarity()
+{
+	if (m_polarityTimer.elapsed() < POLARITY_HUNT_MS)
+		return;
+
+	m_polarityHunts++;
+	if (m_polarityHunts >= POLARITY_HUNTS) {
+		m_polarityDetect = false;
+
+		::fprintf(stdout, "No frames received with either receive polarity, detection stopped" EOL);
+
+		if (m_rxInvert != m_polarityRXInvert)
+			setRXInvert();
+
+		return;
+	}
+
+	::fprintf(stdout, "No frames received, trying the other receive polarity" EOL);
+
+	m_polarityScore  = 0;
+	m_polarityFrames = 0U;
+	m_polarityTimer.start();
+
+	setRXInvert();
+}
+
 bool CMMDVMCal::setFrequency()
 {
 	unsigned char buffer[16U];
@@ -24,6 +24,7 @@
 #include "SerialController.h"
 #include "Console.h"
 #include "BERCal.h"
+#include "StopWatch.h"
 
 #include <cstring>
 #include <cstdlib>
@@ -111,6 +112,12 @@ private:
 	bool              m_pocsagEnabled;
 	bool              m_fmEnabled;
 	bool              m_ax25Enabled;
+	bool              m_polarityDetect;
+	int               m_polarityScore;
+	unsigned int      m_polarityFrames;
+	unsigned int      m_polarityHunts;
+	bool              m_polarityRXInvert;
+	CStopWatch        m_polarityTimer;
 
 	void displayHelp_MMDVM();
 	void displayHelp_MMDVM_HS();
@@ -148,9 +155,14 @@ private:
 	bool setRSSI();
 	bool setM17Cal();
 	bool setIntCal();
+	bool setBERRSSI();
+	bool setPolarityDetect();
 
 	bool initModem();
 	void displayModem(const unsigned char* buffer, unsigned int length);
+	void frameRSSI(const unsigned char* buffer, unsigned int length, unsigned int frameLength);
+	void checkPolarity(int score);
+	void clockPolarity();
 	bool writeConfig1(float txlevel, bool debug);
 	bool writeConfig2(float txlevel, bool debug);
 	void sleep(unsigned int ms);
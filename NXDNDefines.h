@@ -35,6 +35,12 @@ const unsigned int  NXDN_FSW_BYTES_LENGTH = 3U;
 
 const unsigned int NXDN_LICH_LENGTH_BITS = 16U;
 
+const unsigned char NXDN_SCRAMBLER[] = {
+	0x00U, 0x00U, 0x00U, 0x82U, 0xA0U, 0x88U, 0x8AU, 0x00U, 0xA2U, 0xA8U, 0x82U, 0x8AU, 0x82U, 0x02U,
+	0x20U, 0x08U, 0x8AU, 0x20U, 0xAAU, 0xA2U, 0x82U, 0x08U, 0x22U, 0x8AU, 0xAAU, 0x08U, 0x28U, 0x88U,
+	0x28U, 0x28U, 0x00U, 0x0AU, 0x02U, 0x82U, 0x20U, 0x28U, 0x82U, 0x2AU, 0xAAU, 0x20U, 0x22U, 0x80U,
+	0xA8U, 0x8AU, 0x08U, 0xA0U, 0xAAU, 0x02U};
+
 const unsigned int NXDN_SACCH_LENGTH_BITS  = 60U;
 const unsigned int NXDN_FACCH1_LENGTH_BITS = 144U;
 const unsigned int NXDN_FACCH2_LENGTH_BITS = 348U;
@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2018 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2026 by Jonathan Naylor G4KLX
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -16,48 +16,70 @@
  *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  */
 
+#include "BitPermutation.h"
 #include "NXDNDefines.h"
+#include "BitUtils.h"
 #include "NXDNLICH.h"
 
 #include <cstdio>
 #include <cassert>
 #include <cstring>
 
-const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U};
+// The LICH is the first bit of each of its eight dibits
+class CLICHPermutations {
+public:
+	CLICHPermutations() :
+	m_plain(),
+	m_scrambled()
+	{
+		m_plain.add(NXDN_FSW_LENGTH_BITS, 2U, NXDN_LICH_LENGTH_BITS / 2U);
+		m_plain.compile();
+
+		m_scrambled.add(NXDN_FSW_LENGTH_BITS, 2U, NXDN_LICH_LENGTH_BITS / 2U);
+		m_scrambled.compile(NXDN_SCRAMBLER);
+	}
+
+	CBitPermutation m_plain;
+	CBitPermutation m_scrambled;
+};
+
+static const CLICHPermutations& lich_permutations()
+{
+	static const CLICHPermutations p;
 
-#define WRITE_BIT1(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
-#define READ_BIT1(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
+	return p;
+}
 
 CNXDNLICH::CNXDNLICH(const CNXDNLICH& lich) :
-m_lich(NULL)
+m_lich(lich.m_lich)
 {
-	m_lich = new unsigned char[1U];
-	m_lich[0U] = lich.m_lich[0U];
 }
 
 CNXDNLICH::CNXDNLICH() :
-m_lich(NULL)
+m_lich(0x00U)
 {
-	m_lich = new unsigned char[1U];
 }
 
 CNXDNLICH::~CNXDNLICH()
 {
-	delete[] m_lich;
 }
 
-bool CNXDNLICH::decode(const unsigned char* bytes)
+bool CNXDNLICH::decode(const unsigned char* bytes, bool scrambled)
 {
 	assert(bytes != NULL);
 
-	unsigned int offset = NXDN_FSW_LENGTH_BITS;
-	for (unsigned int i = 0U; i < (NXDN_LICH_LENGTH_BITS / 2U); i++, offset += 2U) {
-		bool b = READ_BIT1(bytes, offset);
-		WRITE_BIT1(m_lich, i, b);
-	}
+	const CLICHPermutations& p = lich_permutations();
+
+	unsigned int lich;
+	if (scrambled)
+		p.m_scrambled.gather(bytes, &lich);
+	else
+		p.m_plain.gather(bytes, &lich);
+
+	m_lich = lich;
 
 	bool newParity  = getParity();
-	bool origParity = (m_lich[0U] & 0x01U) == 0x01U;
+	bool origParity = (m_lich & 0x01U) == 0x01U;
 
 	return origParity == newParity;
 }
@@ -68,91 +90,83 @@ void CNXDNLICH::encode(unsigned char* bytes)
 
 	bool parity = getParity();
 	if (parity)
-		m_lich[0U] |= 0x01U;
+		m_lich |= 0x01U;
 	else
-		m_lich[0U] &= 0xFEU;
-
-	unsigned int offset = NXDN_FSW_LENGTH_BITS;
-	for (unsigned int i = 0U; i < (NXDN_LICH_LENGTH_BITS / 2U); i++) {
-		bool b = READ_BIT1(m_lich, i);
-		WRITE_BIT1(bytes, offset, b);
-		offset++;
-		WRITE_BIT1(bytes, offset, true);
-		offset++;
-	}
+		m_lich &= 0xFEU;
+
+	// Each bit of the LICH is followed by a one, and the sixteen bits are written together
+	uint64_t dibits = 0U;
+	for (unsigned int i = 0U; i < (NXDN_LICH_LENGTH_BITS / 2U); i++)
+		dibits = (dibits << 2) | (CBitUtils::readBit(&m_lich, i) ? 0x03U : 0x01U);
+
+	CBitUtils::writeBits(bytes, NXDN_FSW_LENGTH_BITS, dibits, NXDN_LICH_LENGTH_BITS);
 }
 
 unsigned char CNXDNLICH::getRFCT() const
 {
-	return (m_lich[0U] >> 6) & 0x03U;
+	return (m_lich >> 6) & 0x03U;
 }
 
 unsigned char CNXDNLICH::getFCT() const
 {
-	return (m_lich[0U] >> 4) & 0x03U;
+	return (m_lich >> 4) & 0x03U;
 }
 
 unsigned char CNXDNLICH::getOption() const
 {
-	return (m_lich[0U] >> 2) & 0x03U;
+	return (m_lich >> 2) & 0x03U;
 }
 
 unsigned char CNXDNLICH::getDirection() const
 {
-	return (m_lich[0U] >> 1) & 0x01U;
+	return (m_lich >> 1) & 0x01U;
 }
 
 unsigned char CNXDNLICH::getRaw() const
 {
-	bool parity = getParity();
-	if (parity)
-		m_lich[0U] |= 0x01U;
-	else
-		m_lich[0U] &= 0xFEU;
-
-	return m_lich[0U];
+	return (m_lich & 0xFEU) | (getParity() ? 0x01U : 0x00U);
 }
 
 void CNXDNLICH::setRFCT(unsigned char rfct)
 {
-	m_lich[0U] &= 0x3FU;
-	m_lich[0U] |= (rfct << 6) & 0xC0U;
+	m_lich &= 0x3FU;
+	m_lich |= (rfct << 6) & 0xC0U;
 }
 
 void CNXDNLICH::setFCT(unsigned char usc)
 {
-	m_lich[0U] &= 0xCFU;
-	m_lich[0U] |= (usc << 4) & 0x30U;
+	m_lich &= 0xCFU;
+	m_lich |= (usc << 4) & 0x30U;
 }
 
 void CNXDNLICH::setOption(unsigned char option)
 {
-	m_lich[0U] &= 0xF3U;
-	m_lich[0U] |= (option << 2) & 0x0CU;
+	m_lich &= 0xF3U;
+	m_lich |= (option << 2) & 0x0CU;
 }
 
 void CNXDNLICH::setDirection(unsigned char direction)
 {
-	m_lich[0U] &= 0xFDU;
-	m_lich[0U] |= (direction << 1) & 0x02U;
+	m_lich &= 0xFDU;
+	m_lich |= (direction << 1) & 0x02U;
 }
 
 void CNXDNLICH::setRaw(unsigned char lich)
 {
-	m_lich[0U] = lich;
+	m_lich = lich;
 }
 
 CNXDNLICH& CNXDNLICH::operator=(const CNXDNLICH& lich)
 {
 	if (&lich != this)
-		m_lich[0U] = lich.m_lich[0U];
+		m_lich = lich.m_lich;
 
 	return *this;
 }
 
 bool CNXDNLICH::getParity() const
 {
-	switch (m_lich[0U] & 0xF0U) {
+	switch (m_lich & 0xF0U) {
 	case 0x80U:
 	case 0xB0U:
 		return true;
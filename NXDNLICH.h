@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2018 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2018,2026 by Jonathan Naylor G4KLX
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -25,7 +25,8 @@ public:
 	CNXDNLICH();
 	~CNXDNLICH();
 
-	bool decode(const unsigned char* bytes);
+	// The frame may still be scrambled, the LICH is descrambled as it is extracted
+	bool decode(const unsigned char* bytes, bool scrambled = false);
 
 	void encode(unsigned char* bytes);
 
@@ -44,7 +45,7 @@ public:
 	CNXDNLICH& operator=(const CNXDNLICH& lich);
 
 private:
-	unsigned char* m_lich;
+	unsigned char m_lich;
 
 	bool getParity() const;
 };
@@ -1,5 +1,5 @@
 /*
-*   Copyright (C) 2016,2018 by Jonathan Naylor G4KLX
+*   Copyright (C) 2016,2018,2026 by Jonathan Naylor G4KLX
 *
 *   This program is free software; you can redistribute it and/or modify
 *   it under the terms of the GNU General Public License as published by
@@ -17,44 +17,118 @@
 */
 
 #include "P25Utils.h"
+#include "BitUtils.h"
 
 #include <cstdio>
 #include <cassert>
+#include <cstring>
+#include <cstdint>
 
-const unsigned char BIT_MASK_TABLE[] = { 0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U };
+// Each 72 bit block of a frame is 70 bits of data and a two bit status symbol
+const unsigned int  P25_SS_INCREMENT = 72U;
+const unsigned int  P25_SS_DATA      = 70U;
 
-#define WRITE_BIT(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
-#define READ_BIT(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
+// The largest run of bits that CBitUtils::readBits() and writeBits() can take
+const unsigned int  P25_CHUNK_BITS = 56U;
 
-const unsigned int  P25_SS0_START = 70U;
-const unsigned int  P25_SS1_START = 71U;
-const unsigned int  P25_SS_INCREMENT = 72U;
+// An LDU is 24 blocks, each of them nine bytes
+const unsigned int  P25_LDU_LENGTH_BITS       = 1728U;
+const unsigned int  P25_LDU_BLOCKS            = 24U;
+const unsigned int  P25_LDU_BLOCK_BYTES       = 9U;
+const unsigned int  P25_LDU_DATA_LENGTH_BYTES = 210U;
 
-unsigned int CP25Utils::decode(const unsigned char* in, unsigned char* out, unsigned int start, unsigned int stop)
+const unsigned int  P25_NID_START = 48U;
+
+const unsigned int  P25_IMBE_START[] = {114U, 262U, 452U, 640U,  830U, 1020U, 1208U, 1398U, 1578U};
+const unsigned int  P25_IMBE_STOP[]  = {262U, 410U, 600U, 788U,  978U, 1168U, 1356U, 1546U, 1726U};
+
+// Where a bit of the frame ends up once the status symbols are taken out
+static inline unsigned int data_position(unsigned int pos)
 {
-	assert(in != NULL);
-	assert(out != NULL);
+	return pos - 2U * (pos / P25_SS_INCREMENT);
+}
+
+// Adds up to 32 bits to the end of the output, the bits not yet written wait in acc
+static inline void append_bits(uint64_t& acc, unsigned int& bits, unsigned char*& out, uint64_t value, unsigned int length)
+{
+	acc   = (acc << length) | value;
+	bits += length;
+
+	while (bits >= 8U) {
+		bits -= 8U;
+		*out++ = (unsigned char)(acc >> bits);
+	}
+}
+
+// The 1680 data bits of an LDU, each block being 64 bits from one load and six from the byte after
+static void strip_ldu(const unsigned char* in, unsigned char* data)
+{
+	uint64_t acc = 0U;
+	unsigned int bits = 0U;
 
-	// Move the SSx positions to the range needed
-	unsigned int ss0Pos = P25_SS0_START;
-	unsigned int ss1Pos = P25_SS1_START;
+	for (unsigned int i = 0U; i < P25_LDU_BLOCKS; i++, in += P25_LDU_BLOCK_BYTES) {
+		uint64_t value = CBitUtils::load64(in);
 
-	while (ss0Pos < start) {
-		ss0Pos += P25_SS_INCREMENT;
-		ss1Pos += P25_SS_INCREMENT;
+		append_bits(acc, bits, data, value >> 32, 32U);
+		append_bits(acc, bits, data, value & 0xFFFFFFFFU, 32U);
+		append_bits(acc, bits, data, in[8U] >> 2, 6U);
 	}
+}
+
+// The reverse of strip_ldu(), keeping the status symbols in out, data must have a byte to spare
+static void expand_ldu(const unsigned char* data, unsigned char* out)
+{
+	for (unsigned int i = 0U; i < P25_LDU_BLOCKS; i++, out += P25_LDU_BLOCK_BYTES) {
+		unsigned int pos   = i * P25_SS_DATA;
+		unsigned int byte  = pos / 8U;
+		unsigned int shift = pos % 8U;
+
+		// Bits 64 to 69 share the same shift, being a whole number of bytes on
+		uint64_t value = CBitUtils::load64(data + byte);
+		unsigned int last = (data[byte + 8U] << 8) | data[byte + 9U];
+		if (shift > 0U)
+			value = (value << shift) | (data[byte + 8U] >> (8U - shift));
+
+		CBitUtils::store64(out, value);
+		out[8U] = (((last << shift) >> 8) & 0xFCU) | (out[8U] & 0x03U);
+	}
+}
+
+static void copy_bits(const unsigned char* in, unsigned int inPos, unsigned char* out, unsigned int outPos, unsigned int length)
+{
+	while (length > 0U) {
+		unsigned int n = length < P25_CHUNK_BITS ? length : P25_CHUNK_BITS;
+
+		CBitUtils::writeBits(out, outPos, CBitUtils::readBits(in, inPos, n), n);
+
+		inPos  += n;
+		outPos += n;
+		length -= n;
+	}
+}
+
+// The bits between the status symbols are copied as runs of up to 70 bits
+unsigned int CP25Utils::decode(const unsigned char* in, unsigned char* out, unsigned int start, unsigned int stop)
+{
+	assert(in != NULL);
+	assert(out != NULL);
 
 	unsigned int n = 0U;
-	for (unsigned int i = start; i < stop; i++) {
-		if (i == ss0Pos) {
-			ss0Pos += P25_SS_INCREMENT;
-		} else if (i == ss1Pos) {
-			ss1Pos += P25_SS_INCREMENT;
-		} else {
-			bool b = READ_BIT(in, i);
-			WRITE_BIT(out, n, b);
-			n++;
+	unsigned int pos = start;
+	while (pos < stop) {
+		unsigned int end = (pos / P25_SS_INCREMENT) * P25_SS_INCREMENT + P25_SS_DATA;
+		if (pos >= end) {
+			pos = end + 2U;
+			continue;
 		}
+
+		if (end > stop)
+			end = stop;
+
+		copy_bits(in, pos, out, n, end - pos);
+
+		n  += end - pos;
+		pos = end;
 	}
 
 	return n;
@@ -65,26 +139,22 @@ unsigned int CP25Utils::encode(const unsigned char* in, unsigned char* out, unsi
 	assert(in != NULL);
 	assert(out != NULL);
 
-	// Move the SSx positions to the range needed
-	unsigned int ss0Pos = P25_SS0_START;
-	unsigned int ss1Pos = P25_SS1_START;
-
-	while (ss0Pos < start) {
-		ss0Pos += P25_SS_INCREMENT;
-		ss1Pos += P25_SS_INCREMENT;
-	}
-
 	unsigned int n = 0U;
-	for (unsigned int i = start; i < stop; i++) {
-		if (i == ss0Pos) {
-			ss0Pos += P25_SS_INCREMENT;
-		} else if (i == ss1Pos) {
-			ss1Pos += P25_SS_INCREMENT;
-		} else {
-			bool b = READ_BIT(in, n);
-			WRITE_BIT(out, i, b);
-			n++;
+	unsigned int pos = start;
+	while (pos < stop) {
+		unsigned int end = (pos / P25_SS_INCREMENT) * P25_SS_INCREMENT + P25_SS_DATA;
+		if (pos >= end) {
+			pos = end + 2U;
+			continue;
 		}
+
+		if (end > stop)
+			end = stop;
+
+		copy_bits(in, n, out, pos, end - pos);
+
+		n  += end - pos;
+		pos = end;
 	}
 
 	return n;
@@ -95,41 +165,69 @@ unsigned int CP25Utils::encode(const unsigned char* in, unsigned char* out, unsi
 	assert(in != NULL);
 	assert(out != NULL);
 
-	// Move the SSx positions to the range needed
-	unsigned int ss0Pos = P25_SS0_START;
-	unsigned int ss1Pos = P25_SS1_START;
-
 	unsigned int n = 0U;
 	unsigned int pos = 0U;
 	while (n < length) {
-		if (pos == ss0Pos) {
-			ss0Pos += P25_SS_INCREMENT;
-		} else if (pos == ss1Pos) {
-			ss1Pos += P25_SS_INCREMENT;
-		} else {
-			bool b = READ_BIT(in, n);
-			WRITE_BIT(out, pos, b);
-			n++;
+		unsigned int end = (pos / P25_SS_INCREMENT) * P25_SS_INCREMENT + P25_SS_DATA;
+		if (pos >= end) {
+			pos = end + 2U;
+			continue;
 		}
-		pos++;
+
+		if ((end - pos) > (length - n))
+			end = pos + length - n;
+
+		copy_bits(in, n, out, pos, end - pos);
+
+		n  += end - pos;
+		pos = end;
 	}
 
 	return pos;
 }
 
+// The whole LDU has its status symbols taken out in one pass, after which the
+// NID and the IMBE frames all start on byte boundaries
+void CP25Utils::decodeLDU(const unsigned char* in, unsigned char* nid, unsigned char* imbe)
+{
+	assert(in != NULL);
+	assert(nid != NULL);
+	assert(imbe != NULL);
+
+	unsigned char data[P25_LDU_DATA_LENGTH_BYTES];
+	strip_ldu(in, data);
+
+	::memcpy(nid, data + data_position(P25_NID_START) / 8U, P25_NID_LENGTH_BYTES);
+
+	for (unsigned int i = 0U; i < P25_LDU_IMBE_FRAMES; i++)
+		::memcpy(imbe + i * P25_IMBE_LENGTH_BYTES, data + data_position(P25_IMBE_START[i]) / 8U, P25_IMBE_LENGTH_BYTES);
+}
+
+// The rest of the LDU goes through the strip and back unchanged
+void CP25Utils::encodeLDU(const unsigned char* imbe, unsigned char* out)
+{
+	assert(imbe != NULL);
+	assert(out != NULL);
+
+	unsigned char data[P25_LDU_DATA_LENGTH_BYTES + 2U];
+	strip_ldu(out, data);
+	data[P25_LDU_DATA_LENGTH_BYTES + 0U] = 0x00U;
+	data[P25_LDU_DATA_LENGTH_BYTES + 1U] = 0x00U;
+
+	for (unsigned int i = 0U; i < P25_LDU_IMBE_FRAMES; i++)
+		::memcpy(data + data_position(P25_IMBE_START[i]) / 8U, imbe + i * P25_IMBE_LENGTH_BYTES, P25_IMBE_LENGTH_BYTES);
+
+	expand_ldu(data, out);
+}
+
 unsigned int CP25Utils::compare(const unsigned char* data1, const unsigned char* data2, unsigned int length)
 {
 	assert(data1 != NULL);
 	assert(data2 != NULL);
 
 	unsigned int errs = 0U;
-	for (unsigned int i = 0U; i < length; i++) {
-		unsigned char v = data1[i] ^ data2[i];
-		while (v != 0U) {
-			v &= v - 1U;
-			errs++;
-		}
-	}
+	for (unsigned int i = 0U; i < length; i++)
+		errs += CBitUtils::countBits(data1[i] ^ data2[i]);
 
 	return errs;
 }
@@ -1,5 +1,5 @@
 /*
-*   Copyright (C) 2016,2018 by Jonathan Naylor G4KLX
+*   Copyright (C) 2016,2018,2026 by Jonathan Naylor G4KLX
 *
 *   This program is free software; you can redistribute it and/or modify
 *   it under the terms of the GNU General Public License as published by
@@ -19,6 +19,10 @@
 #if !defined(P25Utils_H)
 #define	P25Utils_H
 
+const unsigned int P25_NID_LENGTH_BYTES  = 8U;
+const unsigned int P25_IMBE_LENGTH_BYTES = 18U;
+const unsigned int P25_LDU_IMBE_FRAMES   = 9U;
+
 class CP25Utils {
 public:
 	static unsigned int encode(const unsigned char* in, unsigned char* out, unsigned int start, unsigned int stop);
@@ -26,6 +30,12 @@ public:
 
 	static unsigned int decode(const unsigned char* in, unsigned char* out, unsigned int start, unsigned int stop);
 
+	// The NID and all nine IMBE frames of an LDU, imbe holds 9 x 18 bytes
+	static void decodeLDU(const unsigned char* in, unsigned char* nid, unsigned char* imbe);
+
+	// Puts the nine IMBE frames back into an LDU, leaving the rest of it alone
+	static void encodeLDU(const unsigned char* imbe, unsigned char* out);
+
 	static unsigned int compare(const unsigned char* data1, const unsigned char* data2, unsigned int length);
 
 private:
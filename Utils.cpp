@@ -1,5 +1,5 @@
 /*
- *	Copyright (C) 2009,2014-2016 Jonathan Naylor, G4KLX
+ *	Copyright (C) 2009,2014-2016,2026 Jonathan Naylor, G4KLX
  *
  *	This program is free software; you can redistribute it and/or modify
  *	it under the terms of the GNU General Public License as published by
@@ -12,6 +12,7 @@
  */
 
 #include "Utils.h"
+#include "BitUtils.h"
 
 #include <cstdio>
 #include <cassert>
@@ -69,12 +70,5 @@ void CUtils::bitsToByteBE(const bool* bits, unsigned char& byte)
 {
 	assert(bits != NULL);
 
-	byte  = bits[0U] ? 0x80U : 0x00U;
-	byte |= bits[1U] ? 0x40U : 0x00U;
-	byte |= bits[2U] ? 0x20U : 0x00U;
-	byte |= bits[3U] ? 0x10U : 0x00U;
-	byte |= bits[4U] ? 0x08U : 0x00U;
-	byte |= bits[5U] ? 0x04U : 0x00U;
-	byte |= bits[6U] ? 0x02U : 0x00U;
-	byte |= bits[7U] ? 0x01U : 0x00U;
+	byte = CBitUtils::packByte(bits);
 }
@@ -0,0 +1,1353 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "Verify.h"
+#include "BitPermutation.h"
+#include "CPUDispatch.h"
+#include "Golay24128.h"
+#include "YSFDefines.h"
+#include "BitUtils.h"
+#include "YSFFICH.h"
+#include "Hamming.h"
+#include "Version.h"
+#include "CRC.h"
+
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64)
+#define EOL	"\n"
+#else
+#define	EOL	"\r\n"
+#endif
+
+const unsigned int GOLAY_23127_WORDS = 1U << 23;
+const unsigned int GOLAY_24128_WORDS = 1U << 24;
+const unsigned int GOLAY_DATA_WORDS  = 1U << 12;
+
+// Every pattern of up to three errors in 23 bits
+const unsigned int GOLAY_PATTERNS = 1U + 23U + 253U + 1771U;
+
+const unsigned int GOLAY_BATCH_CHUNK = 4096U;
+
+const unsigned int CRC_ITEMS      = 8192U;
+const unsigned int CRC_BUFFERS    = 8U;
+const unsigned int CRC_MAX_LENGTH = 4096U;
+
+const unsigned int FIVE_BIT_ITEMS = 1U << 20;
+
+const unsigned int VITERBI_ITEMS = 4096U;	// Of VITERBI_LANES frames each
+
+const unsigned int K7_ITEMS = 16384U;
+
+const unsigned int FICH_ITEMS = 65536U;
+
+const unsigned int PERMUTATION_ITEMS  = 2048U;
+const unsigned int PERMUTATION_FRAMES = 32U;
+const unsigned int PERMUTATION_BYTES  = 48U;
+
+// The bool array Hamming encoders and decoders as they were before CHamming
+// was built from the generator rows, kept here as the reference for it, so
+// that the expected results don't come from the rows under test
+
+// Hamming (15,11,3) check a boolean data array
+static bool reference_decode15113_1(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the parity it should have
+	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[6];
+	bool c1 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[7] ^ d[8] ^ d[9];
+	bool c2 = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[8] ^ d[10];
+	bool c3 = d[0] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[9] ^ d[10];
+
+	unsigned char n = 0U;
+	n |= (c0 != d[11]) ? 0x01U : 0x00U;
+	n |= (c1 != d[12]) ? 0x02U : 0x00U;
+	n |= (c2 != d[13]) ? 0x04U : 0x00U;
+	n |= (c3 != d[14]) ? 0x08U : 0x00U;
+
+	switch (n)
+	{
+		// Parity bit errors
+		case 0x01U: d[11] = !d[11]; return true;
+		case 0x02U: d[12] = !d[12]; return true;
+		case 0x04U: d[13] = !d[13]; return true;
+		case 0x08U: d[14] = !d[14]; return true;
+
+		// Data bit errors
+		case 0x0FU: d[0]  = !d[0];  return true;
+		case 0x07U: d[1]  = !d[1];  return true;
+		case 0x0BU: d[2]  = !d[2];  return true;
+		case 0x03U: d[3]  = !d[3];  return true;
+		case 0x0DU: d[4]  = !d[4];  return true;
+		case 0x05U: d[5]  = !d[5];  return true;
+		case 0x09U: d[6]  = !d[6];  return true;
+		case 0x0EU: d[7]  = !d[7];  return true;
+		case 0x06U: d[8]  = !d[8];  return true;
+		case 0x0AU: d[9]  = !d[9];  return true;
+		case 0x0CU: d[10] = !d[10]; return true;
+
+		// No bit errors
+		default: return false;
+	}
+}
+
+static void reference_encode15113_1(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this row should have
+	d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[6];
+	d[12] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[7] ^ d[8] ^ d[9];
+	d[13] = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[8] ^ d[10];
+	d[14] = d[0] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[9] ^ d[10];
+}
+
+// Hamming (15,11,3) check a boolean data array
+static bool reference_decode15113_2(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this row should have
+	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
+	bool c1 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
+	bool c2 = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
+	bool c3 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
+
+	unsigned char n = 0x00U;
+	n |= (c0 != d[11]) ? 0x01U : 0x00U;
+	n |= (c1 != d[12]) ? 0x02U : 0x00U;
+	n |= (c2 != d[13]) ? 0x04U : 0x00U;
+	n |= (c3 != d[14]) ? 0x08U : 0x00U;
+
+	switch (n) {
+		// Parity bit errors
+		case 0x01U: d[11] = !d[11]; return true;
+		case 0x02U: d[12] = !d[12]; return true;
+		case 0x04U: d[13] = !d[13]; return true;
+		case 0x08U: d[14] = !d[14]; return true;
+
+		// Data bit errors
+		case 0x09U: d[0]  = !d[0];  return true;
+		case 0x0BU: d[1]  = !d[1];  return true;
+		case 0x0FU: d[2]  = !d[2];  return true;
+		case 0x07U: d[3]  = !d[3];  return true;
+		case 0x0EU: d[4]  = !d[4];  return true;
+		case 0x05U: d[5]  = !d[5];  return true;
+		case 0x0AU: d[6]  = !d[6];  return true;
+		case 0x0DU: d[7]  = !d[7];  return true;
+		case 0x03U: d[8]  = !d[8];  return true;
+		case 0x06U: d[9]  = !d[9];  return true;
+		case 0x0CU: d[10] = !d[10]; return true;
+
+		// No bit errors
+		default: return false;
+	}
+}
+
+static void reference_encode15113_2(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this row should have
+	d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
+	d[12] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
+	d[13] = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
+	d[14] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
+}
+
+// Hamming (13,9,3) check a boolean data array
+static bool reference_decode1393(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this column should have
+	bool c0 = d[0] ^ d[1] ^ d[3] ^ d[5] ^ d[6];
+	bool c1 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7];
+	bool c2 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
+	bool c3 = d[0] ^ d[2] ^ d[4] ^ d[5] ^ d[8];
+	
+	unsigned char n = 0x00U;
+	n |= (c0 != d[9])  ? 0x01U : 0x00U;
+	n |= (c1 != d[10]) ? 0x02U : 0x00U;
+	n |= (c2 != d[11]) ? 0x04U : 0x00U;
+	n |= (c3 != d[12]) ? 0x08U : 0x00U;
+
+	switch (n) {
+		// Parity bit errors
+		case 0x01U: d[9]  = !d[9];  return true;
+		case 0x02U: d[10] = !d[10]; return true;
+		case 0x04U: d[11] = !d[11]; return true;
+		case 0x08U: d[12] = !d[12]; return true;
+
+		// Data bit erros
+		case 0x0FU: d[0] = !d[0]; return true;
+		case 0x07U: d[1] = !d[1]; return true;
+		case 0x0EU: d[2] = !d[2]; return true;
+		case 0x05U: d[3] = !d[3]; return true;
+		case 0x0AU: d[4] = !d[4]; return true;
+		case 0x0DU: d[5] = !d[5]; return true;
+		case 0x03U: d[6] = !d[6]; return true;
+		case 0x06U: d[7] = !d[7]; return true;
+		case 0x0CU: d[8] = !d[8]; return true;
+
+		// No bit errors
+		default: return false;
+	}
+}
+
+static void reference_encode1393(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this column should have
+	d[9]  = d[0] ^ d[1] ^ d[3] ^ d[5] ^ d[6];
+	d[10] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7];
+	d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
+	d[12] = d[0] ^ d[2] ^ d[4] ^ d[5] ^ d[8];
+}
+
+// Hamming (10,6,3) check a boolean data array
+static bool reference_decode1063(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this column should have
+	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[5];
+	bool c1 = d[0] ^ d[1] ^ d[3] ^ d[5];
+	bool c2 = d[0] ^ d[2] ^ d[3] ^ d[4];
+	bool c3 = d[1] ^ d[2] ^ d[3] ^ d[4];
+
+	unsigned char n = 0x00U;
+	n |= (c0 != d[6]) ? 0x01U : 0x00U;
+	n |= (c1 != d[7]) ? 0x02U : 0x00U;
+	n |= (c2 != d[8]) ? 0x04U : 0x00U;
+	n |= (c3 != d[9]) ? 0x08U : 0x00U;
+
+	switch (n) {
+		// Parity bit errors
+		case 0x01U: d[6] = !d[6]; return true;
+		case 0x02U: d[7] = !d[7]; return true;
+		case 0x04U: d[8] = !d[8]; return true;
+		case 0x08U: d[9] = !d[9]; return true;
+
+		// Data bit erros
+		case 0x07U: d[0] = !d[0]; return true;
+		case 0x0BU: d[1] = !d[1]; return true;
+		case 0x0DU: d[2] = !d[2]; return true;
+		case 0x0EU: d[3] = !d[3]; return true;
+		case 0x0CU: d[4] = !d[4]; return true;
+		case 0x03U: d[5] = !d[5]; return true;
+
+		// No bit errors
+		default: return false;
+	}
+}
+
+static void reference_encode1063(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this column should have
+	d[6] = d[0] ^ d[1] ^ d[2] ^ d[5];
+	d[7] = d[0] ^ d[1] ^ d[3] ^ d[5];
+	d[8] = d[0] ^ d[2] ^ d[3] ^ d[4];
+	d[9] = d[1] ^ d[2] ^ d[3] ^ d[4];
+}
+
+// A Hamming (16,11,4) Check
+static bool reference_decode16114(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this column should have
+	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
+	bool c1 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
+	bool c2 = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
+	bool c3 = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
+	bool c4 = d[0] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[9] ^ d[10];
+
+	// Compare these with the actual bits
+	unsigned char n = 0x00U;
+	n |= (c0 != d[11]) ? 0x01U : 0x00U;
+	n |= (c1 != d[12]) ? 0x02U : 0x00U;
+	n |= (c2 != d[13]) ? 0x04U : 0x00U;
+	n |= (c3 != d[14]) ? 0x08U : 0x00U;
+	n |= (c4 != d[15]) ? 0x10U : 0x00U;
+
+	switch (n) {
+		// Parity bit errors
+		case 0x01U: d[11] = !d[11]; return true;
+		case 0x02U: d[12] = !d[12]; return true;
+		case 0x04U: d[13] = !d[13]; return true;
+		case 0x08U: d[14] = !d[14]; return true;
+		case 0x10U: d[15] = !d[15]; return true;
+
+		// Data bit errors
+		case 0x19U: d[0]  = !d[0];  return true;
+		case 0x0BU: d[1]  = !d[1];  return true;
+		case 0x1FU: d[2]  = !d[2];  return true;
+		case 0x07U: d[3]  = !d[3];  return true;
+		case 0x0EU: d[4]  = !d[4];  return true;
+		case 0x15U: d[5]  = !d[5];  return true;
+		case 0x1AU: d[6]  = !d[6];  return true;
+		case 0x0DU: d[7]  = !d[7];  return true;
+		case 0x13U: d[8]  = !d[8];  return true;
+		case 0x16U: d[9]  = !d[9];  return true;
+		case 0x1CU: d[10] = !d[10]; return true;
+
+		// No bit errors
+		case 0x00U: return true;
+
+		// Unrecoverable errors
+		default: return false;
+	}
+}
+
+static void reference_encode16114(bool* d)
+{
+	assert(d != NULL);
+
+	d[11] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[5] ^ d[7] ^ d[8];
+	d[12] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[6] ^ d[8] ^ d[9];
+	d[13] = d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[7] ^ d[9] ^ d[10];
+	d[14] = d[0] ^ d[1] ^ d[2] ^ d[4] ^ d[6] ^ d[7] ^ d[10];
+	d[15] = d[0] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[9] ^ d[10];
+}
+
+// A Hamming (17,12,3) Check
+static bool reference_decode17123(bool* d)
+{
+	assert(d != NULL);
+
+	// Calculate the checksum this column should have
+	bool c0 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[6] ^ d[7] ^ d[9];
+	bool c1 = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[7] ^ d[8] ^ d[10];
+	bool c2 = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[8] ^ d[9] ^ d[11];
+	bool c3 = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[10];
+	bool c4 = d[0] ^ d[1] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[11];
+
+	// Compare these with the actual bits
+	unsigned char n = 0x00U;
+	n |= (c0 != d[12]) ? 0x01U : 0x00U;
+	n |= (c1 != d[13]) ? 0x02U : 0x00U;
+	n |= (c2 != d[14]) ? 0x04U : 0x00U;
+	n |= (c3 != d[15]) ? 0x08U : 0x00U;
+	n |= (c4 != d[16]) ? 0x10U : 0x00U;
+
+	switch (n) {
+		// Parity bit errors
+		case 0x01U: d[12] = !d[12]; return true;
+		case 0x02U: d[13] = !d[13]; return true;
+		case 0x04U: d[14] = !d[14]; return true;
+		case 0x08U: d[15] = !d[15]; return true;
+		case 0x10U: d[16] = !d[16]; return true;
+
+		// Data bit errors
+		case 0x1BU: d[0]  = !d[0];  return true;
+		case 0x1FU: d[1]  = !d[1];  return true;
+		case 0x17U: d[2]  = !d[2];  return true;
+		case 0x07U: d[3]  = !d[3];  return true;
+		case 0x0EU: d[4]  = !d[4];  return true;
+		case 0x1CU: d[5]  = !d[5];  return true;
+		case 0x11U: d[6]  = !d[6];  return true;
+		case 0x0BU: d[7]  = !d[7];  return true;
+		case 0x16U: d[8]  = !d[8];  return true;
+		case 0x05U: d[9]  = !d[9];  return true;
+		case 0x0AU: d[10] = !d[10]; return true;
+		case 0x14U: d[11] = !d[11]; return true;
+
+		// No bit errors
+		case 0x00U: return true;
+
+		// Unrecoverable errors
+		default: return false;
+	}
+}
+
+static void reference_encode17123(bool* d)
+{
+	assert(d != NULL);
+
+	d[12] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[6] ^ d[7] ^ d[9];
+	d[13] = d[0] ^ d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[7] ^ d[8] ^ d[10];
+	d[14] = d[1] ^ d[2] ^ d[3] ^ d[4] ^ d[5] ^ d[8] ^ d[9] ^ d[11];
+	d[15] = d[0] ^ d[1] ^ d[4] ^ d[5] ^ d[7] ^ d[10];
+	d[16] = d[0] ^ d[1] ^ d[2] ^ d[5] ^ d[6] ^ d[8] ^ d[11];
+}
+
+typedef unsigned int (*HAMMING_ENCODE)(unsigned int data);
+typedef bool (*HAMMING_DECODE)(unsigned int& code);
+typedef void (*HAMMING_ENCODE_BITS)(bool* d);
+typedef bool (*HAMMING_DECODE_BITS)(bool* d);
+
+struct CHammingCode {
+	const char*         m_name;
+	unsigned int        m_length;
+	unsigned int        m_data;
+	HAMMING_ENCODE      m_encode;
+	HAMMING_DECODE      m_decode;
+	HAMMING_ENCODE_BITS m_encodeBits;
+	HAMMING_DECODE_BITS m_decodeBits;
+	HAMMING_ENCODE_BITS m_encodeReference;
+	HAMMING_DECODE_BITS m_decodeReference;
+};
+
+#define	HAMMING_CODE(name, n, k, code)	{name, n, k, static_cast<HAMMING_ENCODE>(&CHamming::encode##code), static_cast<HAMMING_DECODE>(&CHamming::decode##code), \
+	static_cast<HAMMING_ENCODE_BITS>(&CHamming::encode##code), static_cast<HAMMING_DECODE_BITS>(&CHamming::decode##code), \
+	&reference_encode##code, &reference_decode##code}
+
+const CHammingCode HAMMING_CODES[] = {
+	HAMMING_CODE("Hamming (15,11,3) 1", 15U, 11U, 15113_1),
+	HAMMING_CODE("Hamming (15,11,3) 2", 15U, 11U, 15113_2),
+	HAMMING_CODE("Hamming (13,9,3)",    13U,  9U, 1393),
+	HAMMING_CODE("Hamming (10,6,3)",    10U,  6U, 1063),
+	HAMMING_CODE("Hamming (16,11,4)",   16U, 11U, 16114),
+	HAMMING_CODE("Hamming (17,12,3)",   17U, 12U, 17123)};
+
+const unsigned int HAMMING_COUNT = sizeof(HAMMING_CODES) / sizeof(CHammingCode);
+
+// Each item gets its own random numbers, so the results don't depend on the number of threads
+class CItemRandom {
+public:
+	CItemRandom(unsigned int item) :
+	m_state(item * 0x9E3779B9U + 0x12345678U)
+	{
+		if (m_state == 0U)
+			m_state = 1U;
+	}
+
+	unsigned int next()
+	{
+		m_state ^= m_state << 13;
+		m_state ^= m_state >> 17;
+		m_state ^= m_state << 5;
+
+		return m_state;
+	}
+
+private:
+	unsigned int m_state;
+};
+
+// A bit at a time, in the way the CRCs are written down
+static uint32_t crc_reference(const unsigned char* in, unsigned int length, unsigned int width, uint32_t poly, uint32_t init, bool reflected, uint32_t xorout)
+{
+	uint32_t mask = (width == 32U) ? 0xFFFFFFFFU : ((1U << width) - 1U);
+	uint32_t crc  = init;
+
+	for (unsigned int i = 0U; i < length; i++) {
+		for (unsigned int j = 0U; j < 8U; j++) {
+			bool bit = ((in[i] >> (reflected ? j : (7U - j))) & 0x01U) == 0x01U;
+			bool top = ((crc >> (width - 1U)) & 0x01U) == 0x01U;
+
+			crc = (crc << 1) & mask;
+			if (bit != top)
+				crc ^= poly;
+		}
+	}
+
+	if (reflected) {
+		uint32_t out = 0U;
+		for (unsigned int j = 0U; j < width; j++)
+			out |= ((crc >> j) & 0x01U) << (width - 1U - j);
+		crc = out;
+	}
+
+	return crc ^ xorout;
+}
+
+// The YSF FICH decoder as it was before CViterbi, kept here as the reference
+// for it, so that the SSE2 and scalar decoders aren't only checked against
+// each other
+const uint8_t REFERENCE_BRANCH_TABLE1[] = {0U, 0U, 0U, 0U, 1U, 1U, 1U, 1U};
+const uint8_t REFERENCE_BRANCH_TABLE2[] = {0U, 1U, 1U, 0U, 0U, 1U, 1U, 0U};
+
+class CYSFConvolutionReference {
+public:
+	void start()
+	{
+		::memset(m_metrics1, 0x00U, NUM_OF_STATES * sizeof(uint16_t));
+		::memset(m_metrics2, 0x00U, NUM_OF_STATES * sizeof(uint16_t));
+
+		m_oldMetrics = m_metrics1;
+		m_newMetrics = m_metrics2;
+		m_dp = m_decisions;
+	}
+
+	void decode(uint8_t s0, uint8_t s1)
+	{
+		*m_dp = 0U;
+
+		for (uint8_t i = 0U; i < NUM_OF_STATES_D2; i++) {
+			uint8_t j = i * 2U;
+
+			uint16_t metric = (REFERENCE_BRANCH_TABLE1[i] ^ s0) + (REFERENCE_BRANCH_TABLE2[i] ^ s1);
+
+			uint16_t m0 = m_oldMetrics[i] + metric;
+			uint16_t m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + (M - metric);
+			uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
+			m_newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+
+			m0 = m_oldMetrics[i] + (M - metric);
+			m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + metric;
+			uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
+			m_newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+
+			*m_dp |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
+		}
+
+		++m_dp;
+
+		assert((m_dp - m_decisions) <= 180);
+
+		uint16_t* tmp = m_oldMetrics;
+		m_oldMetrics = m_newMetrics;
+		m_newMetrics = tmp;
+	}
+
+	void chainback(unsigned char* out, unsigned int nBits)
+	{
+		assert(out != NULL);
+
+		uint32_t state = 0U;
+
+		while (nBits-- > 0) {
+			--m_dp;
+
+			uint32_t  i = state >> (9 - K);
+			uint8_t bit = uint8_t(*m_dp >> i) & 1;
+			state = (bit << 7) | (state >> 1);
+
+			CBitUtils::writeBit(out, nBits, bit != 0U);
+		}
+	}
+
+private:
+	static const unsigned int NUM_OF_STATES_D2 = 8U;
+	static const unsigned int NUM_OF_STATES    = 16U;
+	static const uint32_t     M = 2U;
+	static const unsigned int K = 5U;
+
+	uint16_t  m_metrics1[NUM_OF_STATES];
+	uint16_t  m_metrics2[NUM_OF_STATES];
+	uint16_t* m_oldMetrics;
+	uint16_t* m_newMetrics;
+	uint64_t  m_decisions[180U];
+	uint64_t* m_dp;
+};
+
+CVerify::CVerify() :
+m_stopWatch(),
+m_threads(std::thread::hardware_concurrency()),
+m_failed(0U),
+m_golay(NULL),
+m_hamming(0U),
+m_vector(NULL),
+m_scalar(NULL),
+m_k7Vector(NULL),
+m_k7Scalar(NULL)
+{
+	if (m_threads == 0U)
+		m_threads = 1U;
+}
+
+CVerify::~CVerify()
+{
+	delete[] m_golay;
+	delete[] m_vector;
+	delete[] m_scalar;
+	delete[] m_k7Vector;
+	delete[] m_k7Scalar;
+}
+
+int CVerify::run()
+{
+	::fprintf(stdout, VERSION " FEC verification, %u threads" EOL, m_threads);
+	CCPUDispatch::print();
+
+	// Any word that the reference misses decodes to 0xFFFF, and fails below
+	m_golay = new uint16_t[GOLAY_23127_WORDS];
+	::memset(m_golay, 0xFFU, GOLAY_23127_WORDS * sizeof(uint16_t));
+	check("Golay (23,12) reference", &CVerify::golayReference, GOLAY_DATA_WORDS, GOLAY_PATTERNS, "words");
+
+	check("Golay (23,12) syndrome", &CVerify::golaySyndrome, GOLAY_23127_WORDS, 1U, "words");
+	check("Golay (23,12) decode", &CVerify::golay23127, GOLAY_23127_WORDS, 1U, "words");
+	check("Golay (24,12) decode", &CVerify::golay24128, GOLAY_24128_WORDS, 1U, "words");
+
+	if (CGolay24128::setDirectTable(true)) {
+		check("Golay (23,12) direct table", &CVerify::golay23127, GOLAY_23127_WORDS, 1U, "words");
+		check("Golay (24,12) direct table", &CVerify::golay24128, GOLAY_24128_WORDS, 1U, "words");
+		CGolay24128::setDirectTable(false);
+	}
+
+	GOLAY_BATCH_TYPE type = CGolayBatch::getType();
+
+	const GOLAY_BATCH_TYPE types[] = {GBT_TABLE, GBT_SCALAR, GBT_AVX2, GBT_AVX512};
+	for (unsigned int i = 0U; i < 4U; i++) {
+		if (!CGolayBatch::setType(types[i]))
+			continue;
+
+		char name[40U];
+		::sprintf(name, "Golay (23,12) batch %s", CGolayBatch::getName(types[i]));
+		check(name, &CVerify::golayBatch23127, GOLAY_23127_WORDS / GOLAY_BATCH_CHUNK, GOLAY_BATCH_CHUNK, "words");
+
+		::sprintf(name, "Golay (24,12) batch %s", CGolayBatch::getName(types[i]));
+		check(name, &CVerify::golayBatch24128, GOLAY_24128_WORDS / GOLAY_BATCH_CHUNK, GOLAY_BATCH_CHUNK, "words");
+	}
+
+	CGolayBatch::setType(type);
+
+	delete[] m_golay;
+	m_golay = NULL;
+
+	for (m_hamming = 0U; m_hamming < HAMMING_COUNT; m_hamming++)
+		check(HAMMING_CODES[m_hamming].m_name, &CVerify::hamming, 1U << HAMMING_CODES[m_hamming].m_length, 1U, "words");
+
+	check("CRC-CCITT and CRC-8", &CVerify::crc, CRC_ITEMS, CRC_BUFFERS, "buffers");
+	check("Five bit CRC", &CVerify::crcFiveBit, FIVE_BIT_ITEMS, 1U, "buffers");
+
+	// The decoders choose SSE2 when they are made, so the scalar ones are made with it turned off
+	unsigned int allowed = CCPUDispatch::getAllowed();
+	CCPUDispatch::setAllowed(allowed & ~CPU_SSE2);
+	m_scalar   = new CYSFConvolution[m_threads];
+	m_k7Scalar = new CK7PuncturedConvolution[m_threads];
+	CCPUDispatch::setAllowed(allowed);
+	m_vector   = new CYSFConvolution[m_threads];
+	m_k7Vector = new CK7PuncturedConvolution[m_threads];
+
+	check("YSF Viterbi", &CVerify::viterbi, VITERBI_ITEMS, VITERBI_LANES, "frames");
+	check("K=7 punctured Viterbi", &CVerify::viterbiPunctured, K7_ITEMS, 1U, "frames");
+	check("YSF FICH encode", &CVerify::fichEncode, FICH_ITEMS, 1U, "frames");
+	check("Bit permutation", &CVerify::permutation, PERMUTATION_ITEMS, PERMUTATION_FRAMES, "frames");
+
+	if (m_failed == 0U)
+		::fprintf(stdout, "All checks passed" EOL);
+	else
+		::fprintf(stdout, "%u checks failed" EOL, m_failed);
+
+	return m_failed == 0U ? 0 : 1;
+}
+
+void CVerify::check(const char* name, CHECK check, unsigned int count, unsigned int size, const char* units)
+{
+	assert(name != NULL);
+	assert(check != NULL);
+	assert(units != NULL);
+
+	std::vector<std::thread> threads;
+	std::vector<unsigned int> failed(m_threads, 0U);
+
+	m_stopWatch.start();
+
+	unsigned int step = (count + m_threads - 1U) / m_threads;
+	for (unsigned int i = 0U; i < m_threads; i++) {
+		unsigned int begin = i * step;
+		unsigned int end   = (begin + step) > count ? count : (begin + step);
+		if (begin >= end)
+			break;
+
+		threads.push_back(std::thread(worker, this, check, begin, end, i, &failed[i]));
+	}
+
+	for (unsigned int i = 0U; i < threads.size(); i++)
+		threads[i].join();
+
+	unsigned int ms = m_stopWatch.elapsed();
+	if (ms == 0U)
+		ms = 1U;
+
+	unsigned int errors = 0U;
+	for (unsigned int i = 0U; i < m_threads; i++)
+		errors += failed[i];
+
+	double total = double(count) * double(size);
+
+	if (errors == 0U) {
+		::fprintf(stdout, "%-28s pass, %.0f %s in %u ms, %.1f k %s/s" EOL, name, total, units, ms, total / double(ms), units);
+	} else {
+		::fprintf(stdout, "%-28s FAIL, %u of %u items differ" EOL, name, errors, count);
+		m_failed++;
+	}
+}
+
+void CVerify::worker(CVerify* verify, CHECK check, unsigned int begin, unsigned int end, unsigned int thread, unsigned int* failed)
+{
+	assert(verify != NULL);
+	assert(failed != NULL);
+
+	*failed = (verify->*check)(begin, end, thread);
+}
+
+// The code is perfect, so every word is within three bits of exactly one
+// code word, and the table is filled by adding every error pattern of up
+// to three bits to every code word. Each item is one code word.
+unsigned int CVerify::golayReference(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	for (unsigned int data = begin; data < end; data++) {
+		unsigned int code = CGolay24128::encode23127(data) >> 1;
+
+		unsigned int n = 0U;
+		m_golay[code] = data;
+		n++;
+
+		for (unsigned int i = 0U; i < 23U; i++) {
+			m_golay[code ^ (1U << i)] = data;
+			n++;
+
+			for (unsigned int j = i + 1U; j < 23U; j++) {
+				m_golay[code ^ (1U << i) ^ (1U << j)] = data;
+				n++;
+
+				for (unsigned int k = j + 1U; k < 23U; k++) {
+					m_golay[code ^ (1U << i) ^ (1U << j) ^ (1U << k)] = data;
+					n++;
+				}
+			}
+		}
+
+		if (n != GOLAY_PATTERNS || (code >> 11) != data)
+			failed++;
+	}
+
+	return failed;
+}
+
+unsigned int CVerify::golaySyndrome(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	for (unsigned int code = begin; code < end; code++) {
+		if (CGolay24128::syndrome23127(code) != CGolay24128::syndrome23127Serial(code))
+			failed++;
+	}
+
+	return failed;
+}
+
+unsigned int CVerify::golay23127(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	for (unsigned int code = begin; code < end; code++) {
+		unsigned int data    = m_golay[code];
+		unsigned int pattern = code ^ (CGolay24128::encode23127(data) >> 1);
+
+		unsigned int errors, pattern1;
+		unsigned int data1 = CGolay24128::decode23127(code);
+		unsigned int data2 = CGolay24128::decode23127(code, errors);
+		unsigned int data3 = CGolay24128::correct23127(code, pattern1);
+
+		if (data1 != data || data2 != data || data3 != data || errors != CBitUtils::countBits(pattern) || pattern1 != pattern)
+			failed++;
+	}
+
+	return failed;
+}
+
+// The extended parity bit counts as an error when the corrected word has the wrong weight
+unsigned int CVerify::golay24128(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	for (unsigned int code = begin; code < end; code++) {
+		unsigned int data    = m_golay[code >> 1];
+		unsigned int pattern = (code ^ CGolay24128::encode24128(data)) & 0xFFFFFFU;
+
+		unsigned int errors, pattern1;
+		unsigned int data1 = CGolay24128::decode24128(code);
+		unsigned int data2 = CGolay24128::decode24128(code, errors);
+		unsigned int data3 = CGolay24128::correct24128(code, pattern1);
+
+		if (data1 != data || data2 != data || data3 != data || errors != CBitUtils::countBits(pattern) || pattern1 != pattern)
+			failed++;
+	}
+
+	return failed;
+}
+
+unsigned int CVerify::golayBatch23127(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	unsigned int codes[GOLAY_BATCH_CHUNK];
+	unsigned int data[GOLAY_BATCH_CHUNK];
+	unsigned int errors[GOLAY_BATCH_CHUNK];
+
+	for (unsigned int item = begin; item < end; item++) {
+		for (unsigned int i = 0U; i < GOLAY_BATCH_CHUNK; i++)
+			codes[i] = item * GOLAY_BATCH_CHUNK + i;
+
+		CGolayBatch::decode23127(codes, data, errors, GOLAY_BATCH_CHUNK);
+
+		for (unsigned int i = 0U; i < GOLAY_BATCH_CHUNK; i++) {
+			unsigned int pattern = codes[i] ^ (CGolay24128::encode23127(m_golay[codes[i]]) >> 1);
+
+			if (data[i] != m_golay[codes[i]] || errors[i] != CBitUtils::countBits(pattern)) {
+				failed++;
+				break;
+			}
+		}
+	}
+
+	return failed;
+}
+
+unsigned int CVerify::golayBatch24128(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	unsigned int codes[GOLAY_BATCH_CHUNK];
+	unsigned int data[GOLAY_BATCH_CHUNK];
+	unsigned int errors[GOLAY_BATCH_CHUNK];
+
+	for (unsigned int item = begin; item < end; item++) {
+		for (unsigned int i = 0U; i < GOLAY_BATCH_CHUNK; i++)
+			codes[i] = item * GOLAY_BATCH_CHUNK + i;
+
+		CGolayBatch::decode24128(codes, data, errors, GOLAY_BATCH_CHUNK);
+
+		for (unsigned int i = 0U; i < GOLAY_BATCH_CHUNK; i++) {
+			unsigned int expected = m_golay[codes[i] >> 1];
+			unsigned int pattern  = (codes[i] ^ CGolay24128::encode24128(expected)) & 0xFFFFFFU;
+
+			if (data[i] != expected || errors[i] != CBitUtils::countBits(pattern)) {
+				failed++;
+				break;
+			}
+		}
+	}
+
+	return failed;
+}
+
+unsigned int CVerify::hamming(unsigned int begin, unsigned int end, unsigned int)
+{
+	const CHammingCode& h = HAMMING_CODES[m_hamming];
+
+	unsigned int failed = 0U;
+
+	for (unsigned int code = begin; code < end; code++) {
+		bool bits[17U];
+		for (unsigned int i = 0U; i < h.m_length; i++)
+			bits[i] = ((code >> (h.m_length - 1U - i)) & 0x01U) == 0x01U;
+
+		bool corrected = h.m_decodeReference(bits);
+
+		unsigned int expected = 0U;
+		for (unsigned int i = 0U; i < h.m_length; i++)
+			expected = (expected << 1) | (bits[i] ? 0x01U : 0x00U);
+
+		unsigned int word = code;
+		bool ret1 = h.m_decode(word);
+
+		for (unsigned int i = 0U; i < h.m_length; i++)
+			bits[i] = ((code >> (h.m_length - 1U - i)) & 0x01U) == 0x01U;
+
+		bool ret2 = h.m_decodeBits(bits);
+
+		unsigned int packed = 0U;
+		for (unsigned int i = 0U; i < h.m_length; i++)
+			packed = (packed << 1) | (bits[i] ? 0x01U : 0x00U);
+
+		bool ok = word == expected && packed == expected && ret1 == corrected && ret2 == corrected;
+
+		// Each data word is also encoded both ways
+		if (code < (1U << h.m_data)) {
+			for (unsigned int i = 0U; i < h.m_data; i++)
+				bits[i] = ((code >> (h.m_data - 1U - i)) & 0x01U) == 0x01U;
+
+			h.m_encodeReference(bits);
+
+			unsigned int reference = 0U;
+			for (unsigned int i = 0U; i < h.m_length; i++)
+				reference = (reference << 1) | (bits[i] ? 0x01U : 0x00U);
+
+			for (unsigned int i = 0U; i < h.m_data; i++)
+				bits[i] = ((code >> (h.m_data - 1U - i)) & 0x01U) == 0x01U;
+
+			h.m_encodeBits(bits);
+
+			packed = 0U;
+			for (unsigned int i = 0U; i < h.m_length; i++)
+				packed = (packed << 1) | (bits[i] ? 0x01U : 0x00U);
+
+			if (packed != reference || h.m_encode(code) != reference)
+				ok = false;
+		}
+
+		if (!ok)
+			failed++;
+	}
+
+	return failed;
+}
+
+// Each item is a batch of buffers of one length, some with good CRCs and some with a bit flipped
+unsigned int CVerify::crc(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	unsigned char* buffers = new unsigned char[CRC_BUFFERS * CRC_MAX_LENGTH];
+	const unsigned char* pointers[CRC_BUFFERS];
+	bool good[CRC_BUFFERS];
+	bool valid[CRC_BUFFERS];
+
+	for (unsigned int item = begin; item < end; item++) {
+		CItemRandom random(item);
+
+		// Mostly short, as a frame would be, but long enough for the fold sometimes
+		unsigned int length = ((item % 16U) == 0U) ? (3U + random.next() % (CRC_MAX_LENGTH - 2U)) : (3U + random.next() % 254U);
+
+		bool ok = true;
+
+		for (unsigned int n = 0U; n < 3U; n++) {
+			for (unsigned int i = 0U; i < CRC_BUFFERS; i++) {
+				unsigned char* p = buffers + i * CRC_MAX_LENGTH;
+				pointers[i] = p;
+
+				for (unsigned int j = 0U; j < length; j++)
+					p[j] = random.next() & 0xFFU;
+
+				unsigned char copy[2U];
+
+				switch (n) {
+				case 0U: {
+						uint32_t crc = crc_reference(p, length - 2U, 16U, 0x1021U, 0xFFFFU, true, 0xFFFFU);
+						CCRC::addCCITT161(p, length);
+						copy[0U] = crc & 0xFFU;
+						copy[1U] = (crc >> 8) & 0xFFU;
+					}
+					break;
+				case 1U: {
+						uint32_t crc = crc_reference(p, length - 2U, 16U, 0x1021U, 0x0000U, false, 0xFFFFU);
+						CCRC::addCCITT162(p, length);
+						copy[0U] = (crc >> 8) & 0xFFU;
+						copy[1U] = crc & 0xFFU;
+					}
+					break;
+				default:
+					if (CCRC::crc8(p, length) != crc_reference(p, length, 8U, 0x07U, 0x00U, false, 0x00U))
+						ok = false;
+					copy[0U] = p[length - 2U];
+					copy[1U] = p[length - 1U];
+					break;
+				}
+
+				if (p[length - 2U] != copy[0U] || p[length - 1U] != copy[1U])
+					ok = false;
+
+				// A single bit error is always found
+				good[i] = (random.next() % 2U) == 0U;
+				if (!good[i]) {
+					unsigned int bit = random.next() % (length * 8U);
+					p[bit / 8U] ^= 0x80U >> (bit % 8U);
+				}
+			}
+
+			if (n == 2U)
+				break;
+
+			if (n == 0U)
+				CCRC::checkCCITT161(pointers, length, valid, CRC_BUFFERS);
+			else
+				CCRC::checkCCITT162(pointers, length, valid, CRC_BUFFERS);
+
+			for (unsigned int i = 0U; i < CRC_BUFFERS; i++) {
+				bool single = (n == 0U) ? CCRC::checkCCITT161(pointers[i], length) : CCRC::checkCCITT162(pointers[i], length);
+				if (valid[i] != good[i] || single != good[i])
+					ok = false;
+			}
+		}
+
+		if (!ok)
+			failed++;
+	}
+
+	delete[] buffers;
+
+	return failed;
+}
+
+unsigned int CVerify::crcFiveBit(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	for (unsigned int item = begin; item < end; item++) {
+		CItemRandom random(item);
+
+		bool in[72U];
+		unsigned int total = 0U;
+		for (unsigned int i = 0U; i < 9U; i++) {
+			unsigned int byte = random.next() & 0xFFU;
+			for (unsigned int j = 0U; j < 8U; j++)
+				in[i * 8U + j] = ((byte >> (7U - j)) & 0x01U) == 0x01U;
+			total += byte;
+		}
+
+		unsigned int crc;
+		CCRC::encodeFiveBit(in, crc);
+
+		if (crc != (total % 31U) || !CCRC::checkFiveBit(in, total % 31U) || CCRC::checkFiveBit(in, (total + 1U) % 31U))
+			failed++;
+	}
+
+	return failed;
+}
+
+// As the YSF FICH, 96 bits and four tail bits, with up to 12 bit errors.
+// The SSE2 and scalar decoders, one frame and a batch at a time, must give
+// what the original decoder does, and a frame without errors must decode to
+// what was sent. The encoder must
+// match the bit by bit one, for the FICH and for a shorter random length.
+unsigned int CVerify::viterbi(unsigned int begin, unsigned int end, unsigned int thread)
+{
+	CYSFConvolution& vector = m_vector[thread];
+	CYSFConvolution& scalar = m_scalar[thread];
+
+	CYSFConvolutionReference reference;
+
+	unsigned int failed = 0U;
+
+	for (unsigned int item = begin; item < end; item++) {
+		CItemRandom random(item);
+
+		unsigned char data[VITERBI_LANES][13U];
+		uint8_t symbols[VITERBI_LANES][200U];
+		unsigned char expected[VITERBI_LANES][13U];
+		unsigned char out[4U][VITERBI_LANES][13U];
+		bool clean[VITERBI_LANES];
+		bool ok = true;
+
+		for (unsigned int n = 0U; n < VITERBI_LANES; n++) {
+			for (unsigned int i = 0U; i < 12U; i++)
+				data[n][i] = random.next() & 0xFFU;
+			data[n][12U] = 0x00U;
+
+			unsigned char encoded[25U];
+			unsigned char serial[25U];
+			vector.encode(data[n], encoded, 100U);
+			vector.encodeSerial(data[n], serial, 100U);
+			if (::memcmp(encoded, serial, 25U) != 0)
+				ok = false;
+
+			unsigned char partial[2U][25U];
+			for (unsigned int i = 0U; i < 25U; i++)
+				partial[0U][i] = partial[1U][i] = random.next() & 0xFFU;
+
+			unsigned int length = 1U + random.next() % 96U;
+			vector.encode(data[n], partial[0U], length);
+			vector.encodeSerial(data[n], partial[1U], length);
+			if (::memcmp(partial[0U], partial[1U], 25U) != 0)
+				ok = false;
+
+			for (unsigned int i = 0U; i < 200U; i++)
+				symbols[n][i] = CBitUtils::readBit(encoded, i) ? 1U : 0U;
+
+			unsigned int errors = random.next() % 13U;
+			for (unsigned int i = 0U; i < errors; i++)
+				symbols[n][random.next() % 200U] ^= 1U;
+			clean[n] = errors == 0U;
+
+			vector.start();
+			scalar.start();
+			reference.start();
+			for (unsigned int i = 0U; i < 100U; i++) {
+				vector.decode(symbols[n][i * 2U + 0U], symbols[n][i * 2U + 1U]);
+				scalar.decode(symbols[n][i * 2U + 0U], symbols[n][i * 2U + 1U]);
+				reference.decode(symbols[n][i * 2U + 0U], symbols[n][i * 2U + 1U]);
+			}
+			vector.chainback(out[0U][n], 96U);
+			scalar.chainback(out[1U][n], 96U);
+			reference.chainback(expected[n], 96U);
+		}
+
+		vector.startBatch();
+		scalar.startBatch();
+		for (unsigned int i = 0U; i < 100U; i++) {
+			uint8_t s0[VITERBI_LANES];
+			uint8_t s1[VITERBI_LANES];
+			for (unsigned int n = 0U; n < VITERBI_LANES; n++) {
+				s0[n] = symbols[n][i * 2U + 0U];
+				s1[n] = symbols[n][i * 2U + 1U];
+			}
+
+			vector.decodeBatch(s0, s1);
+			scalar.decodeBatch(s0, s1);
+		}
+
+		for (unsigned int n = 0U; n < VITERBI_LANES; n++) {
+			vector.chainbackBatch(n, out[2U][n], 96U);
+			scalar.chainbackBatch(n, out[3U][n], 96U);
+
+			for (unsigned int i = 0U; i < 4U; i++) {
+				if (::memcmp(expected[n], out[i][n], 12U) != 0)
+					ok = false;
+			}
+
+			if (clean[n] && ::memcmp(expected[n], data[n], 12U) != 0)
+				ok = false;
+		}
+
+		if (!ok)
+			failed++;
+	}
+
+	return failed;
+}
+
+// A random length of data and six tail bits, with up to three bit errors
+// after puncturing. The encoder must give the unpunctured code bits, from the
+// tables, with those that the pattern drops taken out, and the SSE2 and scalar
+// decoders must agree, and decode a frame without errors to what was sent.
+unsigned int CVerify::viterbiPunctured(unsigned int begin, unsigned int end, unsigned int thread)
+{
+	CK7PuncturedConvolution& vector = m_k7Vector[thread];
+	CK7PuncturedConvolution& scalar = m_k7Scalar[thread];
+
+	CK7Convolution plain;
+
+	unsigned int failed = 0U;
+
+	for (unsigned int item = begin; item < end; item++) {
+		CItemRandom random(item);
+
+		unsigned int length = 1U + random.next() % 190U;
+		unsigned int steps  = length + 6U;
+
+		unsigned char data[25U];
+		::memset(data, 0x00U, 25U);
+		for (unsigned int i = 0U; i < length; i++)
+			CBitUtils::writeBit(data, i, (random.next() & 0x01U) == 0x01U);
+
+		unsigned char encoded[50U];
+		unsigned char serial[50U];
+		::memset(encoded, 0x00U, 50U);
+		::memset(serial, 0x00U, 50U);
+		plain.encode(data, encoded, steps);
+		plain.encodeSerial(data, serial, steps);
+		bool ok = ::memcmp(encoded, serial, 50U) == 0;
+
+		// Puncture it by hand, the pattern 110110 sends four bits of every six
+		unsigned char expected[50U];
+		::memset(expected, 0x00U, 50U);
+		unsigned int bits = 0U;
+		for (unsigned int i = 0U; i < steps * 2U; i++) {
+			if (((0x36U >> (5U - i % 6U)) & 0x01U) == 0x01U)
+				CBitUtils::writeBit(expected, bits++, CBitUtils::readBit(encoded, i));
+		}
+
+		unsigned char punctured[50U];
+		::memset(punctured, 0x00U, 50U);
+		if (vector.encode(data, punctured, steps) != bits || ::memcmp(punctured, expected, 50U) != 0)
+			ok = false;
+
+		unsigned int errors = random.next() % 4U;
+		for (unsigned int i = 0U; i < errors; i++) {
+			unsigned int pos = random.next() % bits;
+			CBitUtils::writeBit(punctured, pos, !CBitUtils::readBit(punctured, pos));
+		}
+
+		unsigned char out[2U][25U];
+		::memset(out, 0x00U, sizeof(out));
+
+		vector.start();
+		vector.decodeBits(punctured, steps);
+		vector.chainback(out[0U], length);
+
+		scalar.start();
+		scalar.decodeBits(punctured, steps);
+		scalar.chainback(out[1U], length);
+
+		if (::memcmp(out[0U], out[1U], 25U) != 0)
+			ok = false;
+
+		if (errors == 0U && ::memcmp(out[0U], data, 25U) != 0)
+			ok = false;
+
+		if (!ok)
+			failed++;
+	}
+
+	return failed;
+}
+
+// A random FICH encoded into a random frame, checked against the bit by bit
+// encoder, including the bits of the frame around the FICH
+unsigned int CVerify::fichEncode(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	for (unsigned int item = begin; item < end; item++) {
+		CItemRandom random(item);
+
+		unsigned char frames[2U][YSF_FRAME_LENGTH_BYTES];
+		for (unsigned int i = 0U; i < YSF_FRAME_LENGTH_BYTES; i++)
+			frames[0U][i] = frames[1U][i] = random.next() & 0xFFU;
+
+		CYSFFICH fich;
+		fich.setFI(random.next() & 0x03U);
+		fich.setFN(random.next() & 0x07U);
+		fich.setFT(random.next() & 0x07U);
+		fich.setMR(random.next() & 0x07U);
+		fich.setVoIP((random.next() & 0x01U) == 0x01U);
+		fich.setDev((random.next() & 0x01U) == 0x01U);
+		fich.setSQL((random.next() & 0x01U) == 0x01U);
+		fich.setSQ(random.next() & 0x7FU);
+
+		CYSFFICH serial(fich);
+
+		fich.encode(frames[0U]);
+		serial.encodeSerial(frames[1U]);
+
+		if (::memcmp(frames[0U], frames[1U], YSF_FRAME_LENGTH_BYTES) != 0)
+			failed++;
+	}
+
+	return failed;
+}
+
+// Each item is a random permutation, with runs of rising positions, strided
+// positions and scattered ones, a random scrambler and whitening, checked
+// against reading the bits one at a time
+unsigned int CVerify::permutation(unsigned int begin, unsigned int end, unsigned int)
+{
+	unsigned int failed = 0U;
+
+	for (unsigned int item = begin; item < end; item++) {
+		CItemRandom random(item);
+
+		unsigned int bytes = 8U + random.next() % (PERMUTATION_BYTES - 7U);
+		unsigned int bits  = bytes * 8U;
+		unsigned int words = 1U + random.next() % BIT_PERMUTATION_MAX_WORDS;
+
+		unsigned int positions[BIT_PERMUTATION_MAX_WORDS][BIT_PERMUTATION_MAX_WORD_BITS];
+		unsigned int lengths[BIT_PERMUTATION_MAX_WORDS];
+
+		CBitPermutation permutation;
+
+		for (unsigned int w = 0U; w < words; w++) {
+			unsigned int length = 1U + random.next() % BIT_PERMUTATION_MAX_WORD_BITS;
+			lengths[w] = length;
+
+			switch (random.next() % 3U) {
+			case 0U: {
+					unsigned int step  = 1U + random.next() % (bits / length);
+					unsigned int start = random.next() % (bits - (length - 1U) * step);
+					for (unsigned int i = 0U; i < length; i++)
+						positions[w][i] = start + i * step;
+					permutation.add(start, step, length);
+				}
+				break;
+			case 1U: {
+					unsigned int pos = random.next() % (bits - length * 2U + 1U);
+					for (unsigned int i = 0U; i < length; i++) {
+						positions[w][i] = pos;
+						pos += 1U + random.next() % 2U;
+					}
+					permutation.add(positions[w], length);
+				}
+				break;
+			default: {
+					unsigned int offset = random.next() % 8U;
+					unsigned int table[BIT_PERMUTATION_MAX_WORD_BITS];
+					for (unsigned int i = 0U; i < length; i++) {
+						table[i] = random.next() % (bits - offset);
+						positions[w][i] = table[i] + offset;
+					}
+					permutation.add(table, length, offset);
+				}
+				break;
+			}
+		}
+
+		unsigned char scrambler[PERMUTATION_BYTES];
+		unsigned char whitening[BIT_PERMUTATION_MAX_WORDS * BIT_PERMUTATION_MAX_WORD_BITS / 8U];
+		for (unsigned int i = 0U; i < PERMUTATION_BYTES; i++)
+			scrambler[i] = random.next() & 0xFFU;
+		for (unsigned int i = 0U; i < sizeof(whitening); i++)
+			whitening[i] = random.next() & 0xFFU;
+
+		bool useScrambler = (random.next() % 2U) == 0U;
+		bool useWhitening = (random.next() % 2U) == 0U;
+
+		permutation.compile(useScrambler ? scrambler : NULL, useWhitening ? whitening : NULL);
+
+		// Without whitening, the scrambler can also be given at each gather, as for NXDN
+		unsigned int init[BIT_PERMUTATION_MAX_WORDS];
+		permutation.getXor(useScrambler ? scrambler : NULL, init);
+
+		bool ok = true;
+
+		for (unsigned int n = 0U; n < PERMUTATION_FRAMES; n++) {
+			unsigned char frame[PERMUTATION_BYTES];
+			for (unsigned int i = 0U; i < PERMUTATION_BYTES; i++)
+				frame[i] = random.next() & 0xFFU;
+
+			unsigned int expected[BIT_PERMUTATION_MAX_WORDS];
+			unsigned int bit = 0U;
+			for (unsigned int w = 0U; w < words; w++) {
+				expected[w] = 0U;
+				for (unsigned int i = 0U; i < lengths[w]; i++, bit++) {
+					unsigned int pos = positions[w][i];
+
+					bool b = CBitUtils::readBit(frame, pos);
+					if (useScrambler)
+						b ^= CBitUtils::readBit(scrambler, pos);
+					if (useWhitening)
+						b ^= CBitUtils::readBit(whitening, bit);
+
+					expected[w] = (expected[w] << 1) | (b ? 0x01U : 0x00U);
+				}
+			}
+
+			unsigned int out[BIT_PERMUTATION_MAX_WORDS];
+
+			permutation.gather(frame, out);
+			if (::memcmp(out, expected, words * sizeof(unsigned int)) != 0)
+				ok = false;
+
+			permutation.gatherTable(frame, out);
+			if (::memcmp(out, expected, words * sizeof(unsigned int)) != 0)
+				ok = false;
+
+			if (permutation.hasExtract()) {
+				permutation.gatherExtract(frame, out);
+				if (::memcmp(out, expected, words * sizeof(unsigned int)) != 0)
+					ok = false;
+			}
+
+			if (!useWhitening) {
+				permutation.gather(frame, init, out);
+				if (::memcmp(out, expected, words * sizeof(unsigned int)) != 0)
+					ok = false;
+			}
+		}
+
+		if (!ok)
+			failed++;
+	}
+
+	return failed;
+}
@@ -0,0 +1,78 @@
+/*
+ *   Copyright (C) 2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(VERIFY_H)
+#define	VERIFY_H
+
+#include "YSFConvolution.h"
+#include "GolayBatch.h"
+#include "StopWatch.h"
+
+#include <cstdint>
+
+// A K = 7 code, punctured to rate 3/4, so that the paths of CViterbi that the
+// YSF FICH doesn't use are checked too
+typedef CViterbi<7U, 0x79U, 0x5BU, 200U> CK7Convolution;
+typedef CViterbi<7U, 0x79U, 0x5BU, 200U, 0x36U, 6U> CK7PuncturedConvolution;
+
+// Checks the optimised FEC kernels against simple reference versions, over
+// every input where that is possible and random ones where it isn't. The
+// work is split between one thread per core. Only the kernels that the CPU
+// dispatch has chosen are checked, so run it again with -cpu to check the
+// others.
+class CVerify {
+public:
+	CVerify();
+	~CVerify();
+
+	// Returns zero if every check passed
+	int run();
+
+private:
+	// Checks the items from begin up to end, returning the number that failed
+	typedef unsigned int (CVerify::*CHECK)(unsigned int begin, unsigned int end, unsigned int thread);
+
+	CStopWatch        m_stopWatch;
+	unsigned int      m_threads;
+	unsigned int      m_failed;
+	uint16_t*         m_golay;
+	unsigned int      m_hamming;
+	CYSFConvolution*  m_vector;
+	CYSFConvolution*  m_scalar;
+	CK7PuncturedConvolution* m_k7Vector;
+	CK7PuncturedConvolution* m_k7Scalar;
+
+	void check(const char* name, CHECK check, unsigned int count, unsigned int size, const char* units);
+	static void worker(CVerify* verify, CHECK check, unsigned int begin, unsigned int end, unsigned int thread, unsigned int* failed);
+
+	unsigned int golayReference(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int golaySyndrome(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int golay23127(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int golay24128(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int golayBatch23127(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int golayBatch24128(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int hamming(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int crc(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int crcFiveBit(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int viterbi(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int viterbiPunctured(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int fichEncode(unsigned int begin, unsigned int end, unsigned int thread);
+	unsigned int permutation(unsigned int begin, unsigned int end, unsigned int thread);
+};
+
+#endif
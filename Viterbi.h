@@ -0,0 +1,597 @@
+/*
+ *   Copyright (C) 2009-2016,2026 by Jonathan Naylor G4KLX
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#if !defined(VITERBI_H)
+#define	VITERBI_H
+
+#include "CPUDispatch.h"
+#include "BitUtils.h"
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define	VITERBI_SSE2
+#endif
+
+// A received symbol that was punctured, it counts the same against both branches
+const uint8_t VITERBI_ERASURE = 0x02U;
+
+// The number of code words that the batch mode decodes at once
+const unsigned int VITERBI_LANES = 16U;
+
+// A hard decision Viterbi decoder for rate 1/2 convolutional codes, with the
+// matching encoder. K is the constraint length, and G1 and G2 the generator
+// polynomials with bit n as the tap on the input bit from n bits before. Both
+// must tap the newest and the oldest bits. PUNCTURE holds which of the
+// PUNCTURE_LENGTH encoded bits are sent, the first in the most significant
+// bit, and MAX_STEPS is the longest trellis that can be decoded.
+//
+// With 16 or more states the add-compare-select uses SSE2, with the 16-bit
+// metrics of eight states to a register, unless CCPUDispatch has it turned off.
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE = 0x03U, unsigned int PUNCTURE_LENGTH = 2U>
+class CViterbi {
+public:
+	CViterbi();
+	~CViterbi();
+
+	// The trellis is traced back from the zero state, so the code words
+	// end with K - 1 zero bits and nBits is the steps decoded less those
+	void start();
+	void decode(uint8_t s0, uint8_t s1);
+	void chainback(unsigned char* out, unsigned int nBits);
+
+	// Depunctures the received bits and decodes nSteps steps of the trellis
+	void decodeBits(const unsigned char* in, unsigned int nSteps);
+
+	// Decodes VITERBI_LANES code words side by side, s0 and s1 hold one
+	// symbol for each of them. The chainback doesn't consume the decisions
+	// so it may be run once for each lane.
+	void startBatch();
+	void decodeBatch(const uint8_t* s0, const uint8_t* s1);
+	void chainbackBatch(unsigned int lane, unsigned char* out, unsigned int nBits) const;
+
+	// Returns the number of bits written after puncturing. Without puncturing
+	// eight bits are encoded at a time from tables, encodeSerial() is the
+	// original bit by bit encoder and the one used with puncturing.
+	unsigned int encode(const unsigned char* in, unsigned char* out, unsigned int nBits) const;
+	unsigned int encodeSerial(const unsigned char* in, unsigned char* out, unsigned int nBits) const;
+
+private:
+	static_assert(K >= 3U && K <= 7U, "The constraint length must be between 3 and 7");
+	static_assert((G1 & G2 & 0x01U) == 0x01U, "Both polynomials must tap the newest bit");
+	static_assert((((G1 & G2) >> (K - 1U)) & 0x01U) == 0x01U, "Both polynomials must tap the oldest bit");
+	static_assert(PUNCTURE_LENGTH >= 1U && PUNCTURE_LENGTH <= 32U, "The puncturing pattern must be between 1 and 32 bits");
+	static_assert(MAX_STEPS < 16384U, "The path metrics must fit in a signed 16-bit value");
+
+	static const unsigned int NUM_OF_STATES    = 1U << (K - 1U);
+	static const unsigned int NUM_OF_STATES_D2 = NUM_OF_STATES / 2U;
+
+	// No two states ever differ by more than (K - 1) * 2, so taking the smallest
+	// metric of each lane away this often keeps the batch metrics in a byte
+	static const unsigned int RENORMALISE_STEPS = 32U;
+
+	static const unsigned int PUNCTURE_NONE = 0xFFFFFFFFU >> (32U - PUNCTURE_LENGTH);
+
+	// The code is linear, so the 16 bits from encoding a byte are those from
+	// the byte after K - 1 zero bits, XORed with those from the K - 1 bits
+	// before it followed by a zero byte
+	class CEncoder {
+	public:
+		CEncoder();
+
+		uint16_t m_data[256U];
+		uint16_t m_state[NUM_OF_STATES];
+
+	private:
+		static uint16_t encodeByte(unsigned int reg, unsigned int data);
+	};
+
+	static const CEncoder& encoder();
+
+	CViterbi(const CViterbi&);
+	CViterbi& operator=(const CViterbi&);
+
+	uint16_t  m_branch1[NUM_OF_STATES_D2];
+	uint16_t  m_branch2[NUM_OF_STATES_D2];
+	uint16_t  m_metrics1[NUM_OF_STATES];
+	uint16_t  m_metrics2[NUM_OF_STATES];
+	uint16_t* m_oldMetrics;
+	uint16_t* m_newMetrics;
+	uint64_t  m_decisions[MAX_STEPS];
+	uint64_t* m_dp;
+	uint8_t*  m_batchMetrics1;
+	uint8_t*  m_batchMetrics2;
+	uint8_t*  m_batchOldMetrics;
+	uint8_t*  m_batchNewMetrics;
+	uint16_t* m_batchDecisions;
+	unsigned int m_batchSteps;
+	bool      m_sse2;
+
+	void acsScalar(uint16_t x0, uint16_t w0, uint16_t x1, uint16_t w1);
+	void acsBatchScalar(const uint8_t* s0, const uint8_t* s1, uint16_t* dp);
+#if defined(VITERBI_SSE2)
+	void acsSSE2(uint16_t x0, uint16_t w0, uint16_t x1, uint16_t w1);
+	void acsBatchSSE2(const uint8_t* s0, const uint8_t* s1, uint16_t* dp);
+#endif
+	void renormalise();
+};
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::CViterbi() :
+m_oldMetrics(NULL),
+m_newMetrics(NULL),
+m_dp(NULL),
+m_batchMetrics1(NULL),
+m_batchMetrics2(NULL),
+m_batchOldMetrics(NULL),
+m_batchNewMetrics(NULL),
+m_batchDecisions(NULL),
+m_batchSteps(0U),
+m_sse2(CCPUDispatch::has(CPU_SSE2))
+{
+	// The encoder outputs leaving each state of the lower half with a zero input
+	for (unsigned int i = 0U; i < NUM_OF_STATES_D2; i++) {
+		m_branch1[i] = CBitUtils::parity((i << 1) & G1);
+		m_branch2[i] = CBitUtils::parity((i << 1) & G2);
+	}
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::~CViterbi()
+{
+	delete[] m_batchMetrics1;
+	delete[] m_batchMetrics2;
+	delete[] m_batchDecisions;
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::start()
+{
+	::memset(m_metrics1, 0x00U, NUM_OF_STATES * sizeof(uint16_t));
+	::memset(m_metrics2, 0x00U, NUM_OF_STATES * sizeof(uint16_t));
+
+	m_oldMetrics = m_metrics1;
+	m_newMetrics = m_metrics2;
+	m_dp = m_decisions;
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::decode(uint8_t s0, uint8_t s1)
+{
+	assert((m_dp - m_decisions) < int(MAX_STEPS));
+
+	// An erased symbol has no weight, so adds the same to every path
+	uint16_t w0 = (s0 == VITERBI_ERASURE) ? 0U : 1U;
+	uint16_t w1 = (s1 == VITERBI_ERASURE) ? 0U : 1U;
+
+#if defined(VITERBI_SSE2)
+	if (NUM_OF_STATES_D2 >= 8U && m_sse2)
+		acsSSE2(s0 & w0, w0, s1 & w1, w1);
+	else
+#endif
+		acsScalar(s0 & w0, w0, s1 & w1, w1);
+
+	++m_dp;
+
+	uint16_t* tmp = m_oldMetrics;
+	m_oldMetrics = m_newMetrics;
+	m_newMetrics = tmp;
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+inline void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::acsScalar(uint16_t x0, uint16_t w0, uint16_t x1, uint16_t w1)
+{
+	uint16_t total = w0 + w1;
+
+	*m_dp = 0U;
+
+	for (unsigned int i = 0U; i < NUM_OF_STATES_D2; i++) {
+		unsigned int j = i * 2U;
+
+		uint16_t metric = ((m_branch1[i] ^ x0) & w0) + ((m_branch2[i] ^ x1) & w1);
+
+		uint16_t m0 = m_oldMetrics[i] + metric;
+		uint16_t m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + (total - metric);
+		uint8_t decision0 = (m0 >= m1) ? 1U : 0U;
+		m_newMetrics[j + 0U] = decision0 != 0U ? m1 : m0;
+
+		m0 = m_oldMetrics[i] + (total - metric);
+		m1 = m_oldMetrics[i + NUM_OF_STATES_D2] + metric;
+		uint8_t decision1 = (m0 >= m1) ? 1U : 0U;
+		m_newMetrics[j + 1U] = decision1 != 0U ? m1 : m0;
+
+		*m_dp |= (uint64_t(decision1) << (j + 1U)) | (uint64_t(decision0) << (j + 0U));
+	}
+}
+
+#if defined(VITERBI_SSE2)
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+inline void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::acsSSE2(uint16_t x0, uint16_t w0, uint16_t x1, uint16_t w1)
+{
+	__m128i sym0  = _mm_set1_epi16(x0);
+	__m128i sym1  = _mm_set1_epi16(x1);
+	__m128i mask0 = _mm_set1_epi16(-int16_t(w0));
+	__m128i mask1 = _mm_set1_epi16(-int16_t(w1));
+	__m128i total = _mm_set1_epi16(w0 + w1);
+
+	uint64_t decisions = 0U;
+
+	// The metrics never exceed 2 * MAX_STEPS, so the signed compares and minimums are safe
+	for (unsigned int i = 0U; i < NUM_OF_STATES_D2; i += 8U) {
+		__m128i lo = _mm_loadu_si128((const __m128i*)(m_oldMetrics + i));
+		__m128i hi = _mm_loadu_si128((const __m128i*)(m_oldMetrics + i + NUM_OF_STATES_D2));
+
+		__m128i b0 = _mm_and_si128(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(m_branch1 + i)), sym0), mask0);
+		__m128i b1 = _mm_and_si128(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(m_branch2 + i)), sym1), mask1);
+
+		__m128i metric  = _mm_add_epi16(b0, b1);
+		__m128i inverse = _mm_sub_epi16(total, metric);
+
+		// The even states
+		__m128i m0 = _mm_add_epi16(lo, metric);
+		__m128i m1 = _mm_add_epi16(hi, inverse);
+		__m128i keep0 = _mm_cmpgt_epi16(m1, m0);
+		__m128i new0  = _mm_min_epi16(m0, m1);
+
+		// The odd states
+		m0 = _mm_add_epi16(lo, inverse);
+		m1 = _mm_add_epi16(hi, metric);
+		__m128i keep1 = _mm_cmpgt_epi16(m1, m0);
+		__m128i new1  = _mm_min_epi16(m0, m1);
+
+		_mm_storeu_si128((__m128i*)(m_newMetrics + i * 2U + 0U), _mm_unpacklo_epi16(new0, new1));
+		_mm_storeu_si128((__m128i*)(m_newMetrics + i * 2U + 8U), _mm_unpackhi_epi16(new0, new1));
+
+		// One byte per state in state order, the decision is set where the lower path wasn't kept
+		__m128i keep = _mm_packs_epi16(_mm_unpacklo_epi16(keep0, keep1), _mm_unpackhi_epi16(keep0, keep1));
+		decisions |= uint64_t(~_mm_movemask_epi8(keep) & 0xFFFF) << (i * 2U);
+	}
+
+	*m_dp = decisions;
+}
+#endif
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::chainback(unsigned char* out, unsigned int nBits)
+{
+	assert(out != NULL);
+	assert(int(nBits) <= (m_dp - m_decisions));
+
+	uint32_t state = 0U;
+
+	while (nBits-- > 0) {
+		--m_dp;
+
+		uint32_t  i = state >> (9 - K);
+		uint8_t bit = uint8_t(*m_dp >> i) & 1;
+		state = (bit << 7) | (state >> 1);
+
+		CBitUtils::writeBit(out, nBits, bit != 0U);
+	}
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::decodeBits(const unsigned char* in, unsigned int nSteps)
+{
+	assert(in != NULL);
+
+	unsigned int n = 0U;
+	unsigned int p = 0U;
+
+	for (unsigned int i = 0U; i < nSteps; i++) {
+		uint8_t s[2U];
+
+		for (unsigned int j = 0U; j < 2U; j++) {
+			if (((PUNCTURE >> (PUNCTURE_LENGTH - 1U - p)) & 0x01U) == 0x01U) {
+				s[j] = CBitUtils::readBit(in, n) ? 1U : 0U;
+				n++;
+			} else {
+				s[j] = VITERBI_ERASURE;
+			}
+
+			p = (p + 1U) % PUNCTURE_LENGTH;
+		}
+
+		decode(s[0U], s[1U]);
+	}
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::startBatch()
+{
+	// Only allocated when needed, as most users decode one code word at a time
+	if (m_batchDecisions == NULL) {
+		m_batchMetrics1  = new uint8_t[NUM_OF_STATES * VITERBI_LANES];
+		m_batchMetrics2  = new uint8_t[NUM_OF_STATES * VITERBI_LANES];
+		m_batchDecisions = new uint16_t[MAX_STEPS * NUM_OF_STATES];
+	}
+
+	::memset(m_batchMetrics1, 0x00U, NUM_OF_STATES * VITERBI_LANES);
+	::memset(m_batchMetrics2, 0x00U, NUM_OF_STATES * VITERBI_LANES);
+
+	m_batchOldMetrics = m_batchMetrics1;
+	m_batchNewMetrics = m_batchMetrics2;
+	m_batchSteps = 0U;
+}
+
+// The batch metrics are held state by state with one byte lane for each code word
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::decodeBatch(const uint8_t* s0, const uint8_t* s1)
+{
+	assert(s0 != NULL);
+	assert(s1 != NULL);
+	assert(m_batchDecisions != NULL);
+	assert(m_batchSteps < MAX_STEPS);
+
+	uint16_t* dp = m_batchDecisions + m_batchSteps * NUM_OF_STATES;
+
+#if defined(VITERBI_SSE2)
+	if (m_sse2)
+		acsBatchSSE2(s0, s1, dp);
+	else
+#endif
+		acsBatchScalar(s0, s1, dp);
+
+	m_batchSteps++;
+
+	uint8_t* tmp = m_batchOldMetrics;
+	m_batchOldMetrics = m_batchNewMetrics;
+	m_batchNewMetrics = tmp;
+
+	if ((m_batchSteps % RENORMALISE_STEPS) == 0U)
+		renormalise();
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+inline void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::acsBatchScalar(const uint8_t* s0, const uint8_t* s1, uint16_t* dp)
+{
+	for (unsigned int i = 0U; i < NUM_OF_STATES_D2; i++) {
+		unsigned int j = i * 2U;
+
+		const uint8_t* lo = m_batchOldMetrics + i * VITERBI_LANES;
+		const uint8_t* hi = m_batchOldMetrics + (i + NUM_OF_STATES_D2) * VITERBI_LANES;
+		uint8_t* new0 = m_batchNewMetrics + (j + 0U) * VITERBI_LANES;
+		uint8_t* new1 = m_batchNewMetrics + (j + 1U) * VITERBI_LANES;
+
+		dp[j + 0U] = 0U;
+		dp[j + 1U] = 0U;
+
+		for (unsigned int n = 0U; n < VITERBI_LANES; n++) {
+			uint8_t w0 = (s0[n] == VITERBI_ERASURE) ? 0U : 1U;
+			uint8_t w1 = (s1[n] == VITERBI_ERASURE) ? 0U : 1U;
+			uint8_t total = w0 + w1;
+
+			uint8_t metric = ((m_branch1[i] ^ s0[n]) & w0) + ((m_branch2[i] ^ s1[n]) & w1);
+
+			uint8_t m0 = lo[n] + metric;
+			uint8_t m1 = hi[n] + (total - metric);
+			new0[n] = (m0 >= m1) ? m1 : m0;
+			if (m0 >= m1)
+				dp[j + 0U] |= 1U << n;
+
+			m0 = lo[n] + (total - metric);
+			m1 = hi[n] + metric;
+			new1[n] = (m0 >= m1) ? m1 : m0;
+			if (m0 >= m1)
+				dp[j + 1U] |= 1U << n;
+		}
+	}
+}
+
+#if defined(VITERBI_SSE2)
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+inline void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::acsBatchSSE2(const uint8_t* s0, const uint8_t* s1, uint16_t* dp)
+{
+	const __m128i* oldMetrics = (const __m128i*)m_batchOldMetrics;
+	__m128i*       newMetrics = (__m128i*)m_batchNewMetrics;
+
+	__m128i ones    = _mm_set1_epi8(1);
+	__m128i erasure = _mm_set1_epi8(VITERBI_ERASURE);
+
+	__m128i sym0 = _mm_loadu_si128((const __m128i*)s0);
+	__m128i sym1 = _mm_loadu_si128((const __m128i*)s1);
+
+	// The weight of each symbol, and the symbol itself, are zero where it was erased
+	__m128i w0 = _mm_andnot_si128(_mm_cmpeq_epi8(sym0, erasure), ones);
+	__m128i w1 = _mm_andnot_si128(_mm_cmpeq_epi8(sym1, erasure), ones);
+	sym0 = _mm_and_si128(sym0, w0);
+	sym1 = _mm_and_si128(sym1, w1);
+
+	__m128i total = _mm_add_epi8(w0, w1);
+
+	for (unsigned int i = 0U; i < NUM_OF_STATES_D2; i++) {
+		unsigned int j = i * 2U;
+
+		__m128i b0 = m_branch1[i] != 0U ? _mm_xor_si128(sym0, w0) : sym0;
+		__m128i b1 = m_branch2[i] != 0U ? _mm_xor_si128(sym1, w1) : sym1;
+
+		__m128i metric  = _mm_add_epi8(b0, b1);
+		__m128i inverse = _mm_sub_epi8(total, metric);
+
+		__m128i lo = _mm_loadu_si128(oldMetrics + i);
+		__m128i hi = _mm_loadu_si128(oldMetrics + i + NUM_OF_STATES_D2);
+
+		// The decision is set where m0 >= m1, that is where the minimum is m1
+		__m128i m0  = _mm_add_epi8(lo, metric);
+		__m128i m1  = _mm_add_epi8(hi, inverse);
+		__m128i min = _mm_min_epu8(m0, m1);
+		_mm_storeu_si128(newMetrics + j + 0U, min);
+		dp[j + 0U] = uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(min, m1)));
+
+		m0  = _mm_add_epi8(lo, inverse);
+		m1  = _mm_add_epi8(hi, metric);
+		min = _mm_min_epu8(m0, m1);
+		_mm_storeu_si128(newMetrics + j + 1U, min);
+		dp[j + 1U] = uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(min, m1)));
+	}
+}
+#endif
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::renormalise()
+{
+#if defined(VITERBI_SSE2)
+	if (m_sse2) {
+		__m128i* metrics = (__m128i*)m_batchOldMetrics;
+
+		__m128i min = _mm_loadu_si128(metrics);
+		for (unsigned int i = 1U; i < NUM_OF_STATES; i++)
+			min = _mm_min_epu8(min, _mm_loadu_si128(metrics + i));
+
+		for (unsigned int i = 0U; i < NUM_OF_STATES; i++)
+			_mm_storeu_si128(metrics + i, _mm_sub_epi8(_mm_loadu_si128(metrics + i), min));
+
+		return;
+	}
+#endif
+
+	for (unsigned int n = 0U; n < VITERBI_LANES; n++) {
+		uint8_t min = m_batchOldMetrics[n];
+		for (unsigned int i = 1U; i < NUM_OF_STATES; i++) {
+			if (m_batchOldMetrics[i * VITERBI_LANES + n] < min)
+				min = m_batchOldMetrics[i * VITERBI_LANES + n];
+		}
+
+		for (unsigned int i = 0U; i < NUM_OF_STATES; i++)
+			m_batchOldMetrics[i * VITERBI_LANES + n] -= min;
+	}
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+void CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::chainbackBatch(unsigned int lane, unsigned char* out, unsigned int nBits) const
+{
+	assert(out != NULL);
+	assert(lane < VITERBI_LANES);
+	assert(nBits <= m_batchSteps);
+
+	uint32_t state = 0U;
+	const uint16_t* dp = m_batchDecisions + m_batchSteps * NUM_OF_STATES;
+
+	while (nBits-- > 0) {
+		dp -= NUM_OF_STATES;
+
+		uint32_t  i = state >> (9 - K);
+		uint8_t bit = (dp[i] >> lane) & 1;
+		state = (bit << 7) | (state >> 1);
+
+		CBitUtils::writeBit(out, nBits, bit != 0U);
+	}
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::CEncoder::CEncoder()
+{
+	for (unsigned int i = 0U; i < 256U; i++)
+		m_data[i] = encodeByte(0U, i);
+
+	for (unsigned int i = 0U; i < NUM_OF_STATES; i++)
+		m_state[i] = encodeByte(i, 0U);
+}
+
+// The register holds the K - 1 bits before the byte, the newest in the bottom bit
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+uint16_t CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::CEncoder::encodeByte(unsigned int reg, unsigned int data)
+{
+	unsigned int code = 0U;
+
+	for (unsigned int i = 0U; i < 8U; i++) {
+		reg = ((reg << 1) | ((data >> (7U - i)) & 0x01U)) & ((1U << K) - 1U);
+		code = (code << 2) | (CBitUtils::parity(reg & G1) << 1) | CBitUtils::parity(reg & G2);
+	}
+
+	return uint16_t(code);
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+const typename CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::CEncoder& CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::encoder()
+{
+	static const CEncoder e;
+
+	return e;
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+unsigned int CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::encode(const unsigned char* in, unsigned char* out, unsigned int nBits) const
+{
+	assert(in != NULL);
+	assert(out != NULL);
+	assert(nBits > 0U);
+
+	if (PUNCTURE != PUNCTURE_NONE)
+		return encodeSerial(in, out, nBits);
+
+	const CEncoder& e = encoder();
+
+	unsigned int state = 0U;
+	unsigned int bytes = nBits / 8U;
+
+	for (unsigned int i = 0U; i < bytes; i++) {
+		unsigned int code = e.m_data[in[i]] ^ e.m_state[state];
+		out[i * 2U + 0U] = (code >> 8) & 0xFFU;
+		out[i * 2U + 1U] = (code >> 0) & 0xFFU;
+
+		state = in[i] & (NUM_OF_STATES - 1U);
+	}
+
+	// The bits after the last one don't change the code bits before them
+	unsigned int rest = nBits % 8U;
+	if (rest > 0U) {
+		unsigned int code = e.m_data[in[bytes] & (0xFF00U >> rest)] ^ e.m_state[state];
+		CBitUtils::writeBits(out, bytes * 16U, code >> (16U - rest * 2U), rest * 2U);
+	}
+
+	return nBits * 2U;
+}
+
+template <unsigned int K, unsigned int G1, unsigned int G2, unsigned int MAX_STEPS, unsigned int PUNCTURE, unsigned int PUNCTURE_LENGTH>
+unsigned int CViterbi<K, G1, G2, MAX_STEPS, PUNCTURE, PUNCTURE_LENGTH>::encodeSerial(const unsigned char* in, unsigned char* out, unsigned int nBits) const
+{
+	assert(in != NULL);
+	assert(out != NULL);
+	assert(nBits > 0U);
+
+	unsigned int reg = 0U;
+	unsigned int p = 0U;
+	unsigned int k = 0U;
+
+	for (unsigned int i = 0U; i < nBits; i++) {
+		unsigned int d = CBitUtils::readBit(in, i) ? 1U : 0U;
+
+		reg = ((reg << 1) | d) & ((1U << K) - 1U);
+
+		unsigned int g[2U];
+		g[0U] = CBitUtils::parity(reg & G1);
+		g[1U] = CBitUtils::parity(reg & G2);
+
+		for (unsigned int j = 0U; j < 2U; j++) {
+			if (((PUNCTURE >> (PUNCTURE_LENGTH - 1U - p)) & 0x01U) == 0x01U) {
+				CBitUtils::writeBit(out, k, g[j] != 0U);
+				k++;
+			}
+
+			p = (p + 1U) % PUNCTURE_LENGTH;
+		}
+	}
+
+	return k;
+}
+
+#endif
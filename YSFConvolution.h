@@ -19,27 +19,12 @@
 #if !defined(YSFConvolution_H)
 #define  YSFConvolution_H
 
-#include <cstdint>
+#include "Viterbi.h"
 
-class CYSFConvolution {
-public:
-	CYSFConvolution();
-	~CYSFConvolution();
+// The YSF FICH code, K = 5 with G1 = 1 + D^3 + D^4 and G2 = 1 + D + D^2 + D^4
+typedef CViterbi<5U, 0x19U, 0x17U, 180U> CYSFConvolution;
 
-	void start();
-	void decode(uint8_t s0, uint8_t s1);
-	void chainback(unsigned char* out, unsigned int nBits);
-
-	void encode(const unsigned char* in, unsigned char* out, unsigned int nBits) const;
-
-private:
-	uint16_t* m_metrics1;
-	uint16_t* m_metrics2;
-	uint16_t* m_oldMetrics;
-	uint16_t* m_newMetrics;
-	uint64_t* m_decisions;
-	uint64_t* m_dp;
-};
+// Built once, in YSFConvolution.cpp
+extern template class CViterbi<5U, 0x19U, 0x17U, 180U>;
 
 #endif
-
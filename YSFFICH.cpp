@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2016,2017,2026 by Jonathan Naylor G4KLX
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -17,7 +17,9 @@
  */
 
 #include "YSFConvolution.h"
+#include "BitPermutation.h"
 #include "YSFDefines.h"
+#include "BitUtils.h"
 #include "Golay24128.h"
 #include "YSFFICH.h"
 #include "CRC.h"
@@ -26,11 +28,6 @@
 #include <cassert>
 #include <cstring>
 
-const unsigned char BIT_MASK_TABLE[] = {0x80U, 0x40U, 0x20U, 0x10U, 0x08U, 0x04U, 0x02U, 0x01U};
-
-#define WRITE_BIT1(p,i,b) p[(i)>>3] = (b) ? (p[(i)>>3] | BIT_MASK_TABLE[(i)&7]) : (p[(i)>>3] & ~BIT_MASK_TABLE[(i)&7])
-#define READ_BIT1(p,i)    (p[(i)>>3] & BIT_MASK_TABLE[(i)&7])
-
 const unsigned int INTERLEAVE_TABLE[] = {
    0U, 40U,  80U, 120U, 160U,
    2U, 42U,  82U, 122U, 162U,
@@ -53,51 +50,129 @@ const unsigned int INTERLEAVE_TABLE[] = {
   36U, 76U, 116U, 156U, 196U,
   38U, 78U, 118U, 158U, 198U};
 
-CYSFFICH::CYSFFICH(const CYSFFICH& fich) :
-m_fich(NULL)
+// The first and second bits of the 100 dibits, in four words of 25 each
+const unsigned int FICH_WORDS       = 8U;
+const unsigned int FICH_WORD_LENGTH = 25U;
+
+class CFICHPermutation {
+public:
+	CFICHPermutation() :
+	m_permutation()
+	{
+		for (unsigned int i = 0U; i < 100U; i += FICH_WORD_LENGTH)
+			m_permutation.add(INTERLEAVE_TABLE + i, FICH_WORD_LENGTH);
+		for (unsigned int i = 0U; i < 100U; i += FICH_WORD_LENGTH)
+			m_permutation.add(INTERLEAVE_TABLE + i, FICH_WORD_LENGTH, 1U);
+		m_permutation.compile();
+	}
+
+	CBitPermutation m_permutation;
+};
+
+static const CBitPermutation& fich_permutation()
 {
-	m_fich = new unsigned char[6U];
+	static const CFICHPermutation p;
 
-	::memcpy(m_fich, fich.m_fich, 6U);
+	return p.m_permutation;
 }
 
-CYSFFICH::CYSFFICH() :
-m_fich(NULL)
+static inline uint8_t fich_bit(const unsigned int* words, unsigned int i)
 {
-	m_fich  = new unsigned char[6U];
+	return (words[i / FICH_WORD_LENGTH] >> (FICH_WORD_LENGTH - 1U - i % FICH_WORD_LENGTH)) & 0x01U;
+}
 
-	memset(m_fich, 0x00U, 6U);
+CYSFFICH::CYSFFICH(const CYSFFICH& fich)
+{
+	::memcpy(m_fich, fich.m_fich, 6U);
+}
+
+CYSFFICH::CYSFFICH()
+{
+	::memset(m_fich, 0x00U, 6U);
 }
 
 CYSFFICH::~CYSFFICH()
 {
-	delete[] m_fich;
 }
 
 bool CYSFFICH::decode(const unsigned char* bytes)
+{
+	CYSFConvolution viterbi;
+
+	return decode(bytes, viterbi);
+}
+
+bool CYSFFICH::decode(const unsigned char* bytes, CYSFConvolution& viterbi)
 {
 	assert(bytes != NULL);
 
 	// Skip the sync bytes
 	bytes += YSF_SYNC_LENGTH_BYTES;
 
-	CYSFConvolution viterbi;
 	viterbi.start();
 
 	// Deinterleave the FICH and send bits to the Viterbi decoder
-	for (unsigned int i = 0U; i < 100U; i++) {
-		unsigned int n = INTERLEAVE_TABLE[i];
-		uint8_t s0 = READ_BIT1(bytes, n) ? 1U : 0U;
+	unsigned int words[FICH_WORDS];
+	fich_permutation().gather(bytes, words);
 
-		n++;
-		uint8_t s1 = READ_BIT1(bytes, n) ? 1U : 0U;
-
-		viterbi.decode(s0, s1);
-	}
+	for (unsigned int i = 0U; i < 100U; i++)
+		viterbi.decode(fich_bit(words, i), fich_bit(words + FICH_WORDS / 2U, i));
 
 	unsigned char output[13U];
 	viterbi.chainback(output, 96U);
 
+	return decodeGolay(output);
+}
+
+void CYSFFICH::decode(const unsigned char* const* bytes, CYSFFICH* fich, bool* valid, unsigned int count)
+{
+	assert(bytes != NULL);
+	assert(fich != NULL);
+	assert(valid != NULL);
+
+	CYSFConvolution viterbi;
+
+	for (unsigned int base = 0U; base < count; base += VITERBI_LANES) {
+		unsigned int lanes = count - base;
+		if (lanes > VITERBI_LANES)
+			lanes = VITERBI_LANES;
+
+		viterbi.startBatch();
+
+		// Unused lanes are decoded from zeros and ignored
+		uint8_t s0[VITERBI_LANES];
+		uint8_t s1[VITERBI_LANES];
+		::memset(s0, 0x00U, VITERBI_LANES);
+		::memset(s1, 0x00U, VITERBI_LANES);
+
+		unsigned int words[VITERBI_LANES][FICH_WORDS];
+		for (unsigned int j = 0U; j < lanes; j++) {
+			assert(bytes[base + j] != NULL);
+			fich_permutation().gather(bytes[base + j] + YSF_SYNC_LENGTH_BYTES, words[j]);
+		}
+
+		for (unsigned int i = 0U; i < 100U; i++) {
+			for (unsigned int j = 0U; j < lanes; j++) {
+				s0[j] = fich_bit(words[j], i);
+				s1[j] = fich_bit(words[j] + FICH_WORDS / 2U, i);
+			}
+
+			viterbi.decodeBatch(s0, s1);
+		}
+
+		for (unsigned int j = 0U; j < lanes; j++) {
+			unsigned char output[13U];
+			viterbi.chainbackBatch(j, output, 96U);
+
+			valid[base + j] = fich[base + j].decodeGolay(output);
+		}
+	}
+}
+
+bool CYSFFICH::decodeGolay(unsigned char* output)
+{
+	assert(output != NULL);
+
 	unsigned int b0 = CGolay24128::decode24128(output + 0U);
 	unsigned int b1 = CGolay24128::decode24128(output + 3U);
 	unsigned int b2 = CGolay24128::decode24128(output + 6U);
@@ -113,12 +188,9 @@ bool CYSFFICH::decode(const unsigned char* bytes)
 	return CCRC::checkCCITT162(m_fich, 6U);
 }
 
-void CYSFFICH::encode(unsigned char* bytes)
+void CYSFFICH::encodeGolay(unsigned char* conv)
 {
-	assert(bytes != NULL);
-
-	// Skip the sync bytes
-	bytes += YSF_SYNC_LENGTH_BYTES;
+	assert(conv != NULL);
 
 	CCRC::addCCITT162(m_fich, 6U);
 
@@ -132,7 +204,6 @@ void CYSFFICH::encode(unsigned char* bytes)
 	unsigned int c2 = CGolay24128::encode24128(b2);
 	unsigned int c3 = CGolay24128::encode24128(b3);
 
-	unsigned char conv[13U];
 	conv[0U]  = (c0 >> 16) & 0xFFU;
 	conv[1U]  = (c0 >> 8) & 0xFFU;
 	conv[2U]  = (c0 >> 0) & 0xFFU;
@@ -146,25 +217,69 @@ void CYSFFICH::encode(unsigned char* bytes)
 	conv[10U] = (c3 >> 8) & 0xFFU;
 	conv[11U] = (c3 >> 0) & 0xFFU;
 	conv[12U] = 0x00U;
+}
+
+void CYSFFICH::encode(unsigned char* bytes)
+{
+	assert(bytes != NULL);
+
+	// Skip the sync bytes
+	bytes += YSF_SYNC_LENGTH_BYTES;
+
+	unsigned char conv[13U];
+	encodeGolay(conv);
 
 	CYSFConvolution convolution;
 	unsigned char convolved[25U];
 	convolution.encode(conv, convolved, 100U);
 
+	// The interleaving sends every fifth dibit to the same 40 bits of the FICH,
+	// so each five bytes of the convolved FICH give a byte to each of them
+	uint64_t rows[5U] = {0U, 0U, 0U, 0U, 0U};
+	for (unsigned int i = 0U; i < 25U; i += 5U) {
+		uint64_t value = CBitUtils::readBits(convolved, i * 8U, 40U);
+
+		for (unsigned int r = 0U; r < 5U; r++) {
+			unsigned int shift = r * 2U;
+			unsigned int byte = (((value >> (38U - shift)) & 0x03U) << 6) | (((value >> (28U - shift)) & 0x03U) << 4) |
+								(((value >> (18U - shift)) & 0x03U) << 2) | (((value >> (8U - shift)) & 0x03U) << 0);
+
+			rows[r] = (rows[r] << 8) | byte;
+		}
+	}
+
+	for (unsigned int r = 0U; r < 5U; r++)
+		CBitUtils::writeBits(bytes, r * 40U, rows[r], 40U);
+}
+
+void CYSFFICH::encodeSerial(unsigned char* bytes)
+{
+	assert(bytes != NULL);
+
+	// Skip the sync bytes
+	bytes += YSF_SYNC_LENGTH_BYTES;
+
+	unsigned char conv[13U];
+	encodeGolay(conv);
+
+	CYSFConvolution convolution;
+	unsigned char convolved[25U];
+	convolution.encodeSerial(conv, convolved, 100U);
+
 	unsigned int j = 0U;
 	for (unsigned int i = 0U; i < 100U; i++) {
 		unsigned int n = INTERLEAVE_TABLE[i];
 
-		bool s0 = READ_BIT1(convolved, j) != 0U;
+		bool s0 = CBitUtils::readBit(convolved, j);
 		j++;
 
-		bool s1 = READ_BIT1(convolved, j) != 0U;
+		bool s1 = CBitUtils::readBit(convolved, j);
 		j++;
 
-		WRITE_BIT1(bytes, n, s0);
+		CBitUtils::writeBit(bytes, n, s0);
 
 		n++;
-		WRITE_BIT1(bytes, n, s1);
+		CBitUtils::writeBit(bytes, n, s1);
 	}
 }
 
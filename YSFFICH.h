@@ -1,5 +1,5 @@
 /*
- *   Copyright (C) 2016,2017 by Jonathan Naylor G4KLX
+ *   Copyright (C) 2016,2017,2026 by Jonathan Naylor G4KLX
  *
  *   This program is free software; you can redistribute it and/or modify
  *   it under the terms of the GNU General Public License as published by
@@ -19,6 +19,8 @@
 #if !defined(YSFFICH_H)
 #define  YSFFICH_H
 
+#include "YSFConvolution.h"
+
 class CYSFFICH {
 public:
 	CYSFFICH(const CYSFFICH& fich);
@@ -27,8 +29,17 @@ public:
 
 	bool decode(const unsigned char* bytes);
 
+	// The same, but with a decoder kept by the caller so that nothing is set up per frame
+	bool decode(const unsigned char* bytes, CYSFConvolution& viterbi);
+
+	// Decodes the FICHs of many frames, several at a time, for offline use
+	static void decode(const unsigned char* const* bytes, CYSFFICH* fich, bool* valid, unsigned int count);
+
 	void encode(unsigned char* bytes);
 
+	// The original bit by bit version of encode(), kept as a reference for it
+	void encodeSerial(unsigned char* bytes);
+
 	unsigned char getFI() const;
 	unsigned char getCM() const;
 	unsigned char getBN() const;
@@ -53,7 +64,10 @@ public:
 	CYSFFICH& operator=(const CYSFFICH& fich);
 
 private:
-	unsigned char* m_fich;
+	unsigned char m_fich[6U];
+
+	bool decodeGolay(unsigned char* output);
+	void encodeGolay(unsigned char* conv);
 };
 
 #endif